@@ -37,6 +37,7 @@ public class P_EAIS : ModuleRules
 			{
 				"Json",
 				"JsonUtilities",
+				"Projects",          // For IPluginManager (reads Config/DefaultEAIS.ini)
 				"Slate",
 				"SlateCore",
 			}
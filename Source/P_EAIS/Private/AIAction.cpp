@@ -11,230 +11,475 @@
 #include "GameFramework/PlayerController.h"
 #include "Navigation/PathFollowingComponent.h"
 #include "Kismet/GameplayStatics.h"
-#include "EAIS_TargetProvider.h"
 #include "EAIS_ActionExecutor.h"
+#include "EAIS_KickHandler.h"
+#include "EAISSubsystem.h"
+#include "EAIS_Program.h"
 #include "UObject/UObjectIterator.h"
 
 // Include P_MEIS for input injection
 #include "Manager/CPP_BPL_InputBinding.h"
 
-void UAIAction::Complete()
+void UAIAction::FinishLatentAction(UAIComponent* OwnerComponent, const FAIActionParams& Params, EAIActionStatus Status)
 {
-    bIsRunning = false;
+    if (OwnerComponent)
+    {
+        OwnerComponent->GetInterpreter().FinishRunningAction(this, Params, Status);
+    }
 }
 
-// ==================== MoveTo ====================
+namespace
+{
+    /** Parse one param text by schema type */
+    FEAISParamValue ParseParamValue(const FString& Text, EEAISParamType Type)
+    {
+        FEAISParamValue Param;
+        Param.bIsSet = true;
+
+        switch (Type)
+        {
+        case EEAISParamType::Bool:
+            Param.Value = FBlackboardValue(Text.Equals(TEXT("true"), ESearchCase::IgnoreCase) || Text.Equals(TEXT("1")));
+            break;
+        case EEAISParamType::Int:
+            Param.Value = FBlackboardValue(FCString::Atoi(*Text));
+            break;
+        case EEAISParamType::Float:
+            Param.Value = FBlackboardValue(FCString::Atof(*Text));
+            break;
+        case EEAISParamType::Vector:
+        {
+            FVector Vector = FVector::ZeroVector;
+            Param.bIsSet = Text.StartsWith(TEXT("(")) && Vector.InitFromString(Text);
+            Param.Value = FBlackboardValue(Vector);
+            break;
+        }
+        case EEAISParamType::Name:
+            Param.Name = FName(*Text);
+            Param.Value = FBlackboardValue(Text);
+            break;
+        case EEAISParamType::Auto:
+            if (Text.Equals(TEXT("true"), ESearchCase::IgnoreCase) || Text.Equals(TEXT("false"), ESearchCase::IgnoreCase))
+            {
+                Param.Value = FBlackboardValue(Text.Equals(TEXT("true"), ESearchCase::IgnoreCase));
+            }
+            else if (Text.IsNumeric())
+            {
+                Param.Value = FBlackboardValue(FCString::Atof(*Text));
+            }
+            else
+            {
+                Param.Value = FBlackboardValue(Text);
+            }
+            break;
+        default:
+            Param.Value = FBlackboardValue(Text);
+            break;
+        }
 
-void UAIAction_MoveTo::Execute_Implementation(UAIComponent* OwnerComponent, const FAIActionParams& Params)
+        return Param;
+    }
+}
+
+namespace
 {
-    if (!OwnerComponent)
+    /** Names published by UEAISSubsystem::RegisterAction and names resolved from GetActionName */
+    TMap<FString, TWeakObjectPtr<UClass>>& GetActionClassRegistry()
     {
-        return;
+        static TMap<FString, TWeakObjectPtr<UClass>> Registry;
+        return Registry;
     }
 
-    UWorld* World = OwnerComponent->GetWorld();
-    if (!World)
+    /** Text of a schema param in an entry's params ("target" falls back to FAIActionParams::Target) */
+    const FString* FindParamText(const FAIActionParams& Params, const FEAISActionParamSchema::FParam& Param)
     {
-        return;
+        const FString* Text = Params.ExtraParams.Find(Param.Key);
+        if (!Text && Param.Key == TEXT("target") && !Params.Target.IsEmpty())
+        {
+            Text = &Params.Target;
+        }
+        return Text;
     }
+}
 
-    APawn* Pawn = OwnerComponent->GetOwnerPawn();
-    if (!Pawn)
+const FEAISActionParamSchema& UAIAction::GetParamSchema()
+{
+    if (!bParamSchemaDeclared)
     {
-        return;
+        DeclareParams(ParamSchema);
+        bParamSchemaDeclared = true;
     }
+    return ParamSchema;
+}
 
-    AAIController* AIController = Cast<AAIController>(Pawn->GetController());
-    if (!AIController)
+void UAIAction::PrepareParams(FAIActionParams& Params)
+{
+    if (Params.ParamBlock.IsValid() && Params.ParamBlock->SchemaOwner.Get() == GetClass())
     {
         return;
     }
 
-    SetRunning(true);
-
-    // Get target location
-    FVector TargetLocation = FVector::ZeroVector;
-    bool bTargetFound = false;
+    Params.ParamBlock = BuildParamBlock(GetClass(), Params);
+}
 
-    // 1. Try TargetProvider
-    if (IEAIS_TargetProvider* TargetProvider = Cast<IEAIS_TargetProvider>(Pawn))
+TSubclassOf<UAIAction> UAIAction::FindActionClass(const FString& ActionName)
+{
+    TMap<FString, TWeakObjectPtr<UClass>>& Registry = GetActionClassRegistry();
+    if (const TWeakObjectPtr<UClass>* Found = Registry.Find(ActionName))
     {
-        bTargetFound = IEAIS_TargetProvider::Execute_EAIS_GetTargetLocation(Pawn, FName(*Params.Target), TargetLocation);
+        if (UClass* Class = Found->Get())
+        {
+            return Class;
+        }
     }
 
-    // 2. Fallback to basic tag-based or blackboard
-    if (!bTargetFound)
+    // Not registered yet (programs compiled before the subsystem starts): match built-in and native names
+    for (TObjectIterator<UClass> It; It; ++It)
     {
-        // Check if target is "ball" - special case
-        if (Params.Target.Equals(TEXT("ball"), ESearchCase::IgnoreCase))
+        UClass* Class = *It;
+        if (Class->IsChildOf(UAIAction::StaticClass()) && !Class->HasAnyClassFlags(CLASS_Abstract | CLASS_Deprecated | CLASS_NewerVersionExists)
+            && Class->GetDefaultObject<UAIAction>()->GetActionName() == ActionName)
         {
-            // Find ball actor
-            TArray<AActor*> FoundActors;
-            UGameplayStatics::GetAllActorsWithTag(OwnerComponent->GetWorld(), FName(TEXT("Ball")), FoundActors);
-            if (FoundActors.Num() > 0)
-            {
-                TargetLocation = FoundActors[0]->GetActorLocation();
-                bTargetFound = true;
-            }
+            Registry.Add(ActionName, Class);
+            return Class;
         }
-        else if (Params.Target.StartsWith(TEXT("(")))
-        {
-            // Parse vector string
-            TargetLocation.InitFromString(Params.Target);
-            bTargetFound = true;
-        }
-        else
+    }
+
+    return nullptr;
+}
+
+void UAIAction::RegisterActionClass(const FString& ActionName, TSubclassOf<UAIAction> ActionClass)
+{
+    if (!ActionName.IsEmpty() && ActionClass)
+    {
+        GetActionClassRegistry().Add(ActionName, ActionClass.Get());
+    }
+}
+
+TSharedPtr<const FEAISActionParamBlock> UAIAction::BuildParamBlock(TSubclassOf<UAIAction> ActionClass, const FAIActionParams& Params)
+{
+    if (!ActionClass)
+    {
+        return nullptr;
+    }
+
+    const FEAISActionParamSchema& Schema = ActionClass->GetDefaultObject<UAIAction>()->GetParamSchema();
+    if (Schema.Params.Num() == 0)
+    {
+        return nullptr;
+    }
+
+    TSharedRef<FEAISActionParamBlock> Block = MakeShared<FEAISActionParamBlock>();
+    Block->SchemaOwner = ActionClass.Get();
+    Block->Values.SetNum(Schema.Params.Num());
+    for (int32 Index = 0; Index < Schema.Params.Num(); ++Index)
+    {
+        if (const FString* Text = FindParamText(Params, Schema.Params[Index]))
         {
-            // Try to get from blackboard
-            TargetLocation = OwnerComponent->GetBlackboardVector(Params.Target);
-            bTargetFound = !TargetLocation.IsZero();
+            Block->Values[Index] = ParseParamValue(*Text, Schema.Params[Index].Type);
         }
     }
 
-    if (!bTargetFound)
+    return Block;
+}
+
+const FEAISParamValue* UAIAction::GetParam(const FAIActionParams& Params, int32 Index)
+{
+    if (Params.ParamBlock.IsValid() && Params.ParamBlock->SchemaOwner.Get() == GetClass())
     {
-        UE_LOG(LogTemp, Warning, TEXT("UAIAction_MoveTo: Could not resolve target '%s'"), *Params.Target);
-        return;
+        return Params.GetParam(GetClass(), Index);
     }
 
-    // Move to target
-    float AcceptanceRadius = 50.0f;
+    // Runtime-built params (Blueprint calls) or a block laid out for another class: parse just this param, no block allocation
+    const FEAISActionParamSchema& Schema = GetParamSchema();
+    if (!Schema.Params.IsValidIndex(Index))
+    {
+        return nullptr;
+    }
 
-    // Avoid repeatedly spamming MoveTo every tick for essentially the same destination.
-    // This is especially important for crowd/avoidance and to prevent visible stutter.
+    const FString* Text = FindParamText(Params, Schema.Params[Index]);
+    if (!Text)
     {
-        static const FString LastTargetKey = TEXT("__EAIS_LastMoveToTarget");
-        static const FString LastTimeKey = TEXT("__EAIS_LastMoveToTime");
-        constexpr float MinRetargetDistance = 25.0f;  // cm
-        constexpr float MinRetargetInterval = 0.15f;  // seconds
+        return nullptr;
+    }
 
-        const FVector LastTarget = OwnerComponent->GetBlackboardVector(LastTargetKey);
-        const float LastTime = OwnerComponent->GetBlackboardFloat(LastTimeKey);
-        const float Now = World->GetTimeSeconds();
+    UnpreparedParams.SetNum(Schema.Params.Num());
+    FEAISParamValue& Param = UnpreparedParams[Index];
+    Param = ParseParamValue(*Text, Schema.Params[Index].Type);
+    return Param.bIsSet ? &Param : nullptr;
+}
 
-        const bool bHasLast = !LastTarget.IsZero() && LastTime > 0.0f;
-        const bool bSameTarget = bHasLast && FVector::DistSquared(LastTarget, TargetLocation) <= FMath::Square(MinRetargetDistance);
-        const bool bTooSoon = bHasLast && (Now - LastTime) < MinRetargetInterval;
+bool UAIAction::ResolveTargetLocation(UAIComponent* OwnerComponent, const FAIActionParams& Params, FVector& OutLocation)
+{
+    if (!OwnerComponent)
+    {
+        return false;
+    }
 
-        if (bSameTarget && bTooSoon)
+    // "$Key" binding: one indexed read, no other fallbacks
+    const FAIInterpreter& Interpreter = OwnerComponent->GetInterpreter();
+    if (Params.IsTargetBound())
+    {
+        return Interpreter.GetBlackboardLocation(Params.TargetSlot, OutLocation);
+    }
+
+    // Target provider id (game-specific resolution, cached per agent and batched per frame)
+    if (OwnerComponent->ResolveProviderTarget(Params.GetTargetName(), OutLocation))
+    {
+        return true;
+    }
+
+    // Unbound key of the same name; only set keys count, so a zero vector is a valid location
+    return Interpreter.GetBlackboardLocation(Params.Target, OutLocation);
+}
+
+// ==================== MoveTo ====================
+
+namespace
+{
+    enum EMoveToParam { MoveToParam_Location };
+}
+
+void UAIAction_MoveTo::DeclareParams(FEAISActionParamSchema& Schema) const
+{
+    Schema.Add(TEXT("target"), EEAISParamType::Vector);
+}
+
+bool UAIAction_MoveTo::ResolveTarget(UAIComponent* OwnerComponent, const FAIActionParams& Params, FVector& OutLocation)
+{
+    // 1. Vector literal (parsed once per entry)
+    if (!Params.IsTargetBound())
+    {
+        if (const FEAISParamValue* Location = GetParam(Params, MoveToParam_Location))
         {
-            return;
+            OutLocation = Location->Value.VectorValue;
+            return true;
         }
-
-        OwnerComponent->SetBlackboardVector(LastTargetKey, TargetLocation);
-        OwnerComponent->SetBlackboardFloat(LastTimeKey, Now);
     }
 
-    EPathFollowingRequestResult::Type Result = AIController->MoveToLocation(TargetLocation, AcceptanceRadius, true, true, true, true);
-    
-    if (Result == EPathFollowingRequestResult::Failed)
+    // 2. "$Key" binding, TargetProvider or blackboard key
+    if (ResolveTargetLocation(OwnerComponent, Params, OutLocation))
     {
-        UE_LOG(LogTemp, Error, TEXT("UAIAction_MoveTo: MoveToLocation FAILED for %s -> %s. NavMesh might be missing or target unreachable."), *Pawn->GetName(), *TargetLocation.ToString());
+        return true;
     }
-    else
+
+    // 3. Fallback to the ball tag
+    if (!Params.IsTargetBound() && Params.Target.Equals(TEXT("ball"), ESearchCase::IgnoreCase))
     {
-        UE_LOG(LogTemp, Verbose, TEXT("UAIAction_MoveTo: MoveToLocation Request: %s"), *UEnum::GetValueAsString(Result));
+        TArray<AActor*> FoundActors;
+        UGameplayStatics::GetAllActorsWithTag(OwnerComponent->GetWorld(), FName(TEXT("Ball")), FoundActors);
+        if (FoundActors.Num() > 0)
+        {
+            OutLocation = FoundActors[0]->GetActorLocation();
+            return true;
+        }
     }
 
-    PathFollowingComp = AIController->GetPathFollowingComponent();
+    return false;
 }
 
-void UAIAction_MoveTo::Abort_Implementation()
+EAIActionStatus UAIAction_MoveTo::RequestMove(UAIComponent* OwnerComponent, const FAIActionParams& Params)
 {
-    if (PathFollowingComp.IsValid())
+    APawn* Pawn = OwnerComponent ? OwnerComponent->GetOwnerPawn() : nullptr;
+    UEAISSubsystem* Subsystem = UEAISSubsystem::Get(OwnerComponent);
+    if (!Pawn || !Subsystem)
     {
-        PathFollowingComp->AbortMove(*this, FPathFollowingResultFlags::UserAbort);
+        return EAIActionStatus::Failed;
     }
-    SetRunning(false);
+
+    FVector TargetLocation = FVector::ZeroVector;
+    if (!ResolveTarget(OwnerComponent, Params, TargetLocation))
+    {
+        UE_LOG(LogTemp, Warning, TEXT("UAIAction_MoveTo: Could not resolve target '%s'"), *Params.Target);
+        return EAIActionStatus::Failed;
+    }
+
+    // Near-identical goals are coalesced by the subsystem against the agent's active request
+    return Subsystem->RequestMove(OwnerComponent, TargetLocation, Params);
 }
 
-// ==================== Log ====================
+EAIActionStatus UAIAction_MoveTo::Execute_Implementation(UAIComponent* OwnerComponent, const FAIActionParams& Params)
+{
+    return RequestMove(OwnerComponent, Params);
+}
 
-void UAIAction_Log::Execute_Implementation(UAIComponent* OwnerComponent, const FAIActionParams& Params)
+EAIActionStatus UAIAction_MoveTo::TickAction_Implementation(UAIComponent* OwnerComponent, const FAIActionParams& Params, float DeltaSeconds)
 {
-    FString Message = Params.ExtraParams.FindRef(TEXT("message"));
-    if (Message.IsEmpty())
+    APawn* Pawn = OwnerComponent ? OwnerComponent->GetOwnerPawn() : nullptr;
+    AAIController* AIController = Pawn ? Cast<AAIController>(Pawn->GetController()) : nullptr;
+    if (!AIController)
+    {
+        return EAIActionStatus::Failed;
+    }
+
+    // Path following finished since the last tick (a pending async path has not started it yet)
+    FEAISMoveRequestState& Move = OwnerComponent->GetMoveState();
+    if (!Move.bPathPending && AIController->GetMoveStatus() == EPathFollowingStatus::Idle)
     {
-        Message = Params.Target;
+        if (Move.Status == EAIActionStatus::Running)
+        {
+            const UPathFollowingComponent* PathFollowing = AIController->GetPathFollowingComponent();
+            Move.Status = PathFollowing && PathFollowing->DidMoveReachGoal() ? EAIActionStatus::Succeeded : EAIActionStatus::Failed;
+        }
+        return Move.Status;
     }
-    
-    UE_LOG(LogTemp, Warning, TEXT("AI_LOG [%s]: %s"), *OwnerComponent->GetOwner()->GetName(), *Message);
-    Complete();
+
+    // Still moving: follow a moving target
+    return RequestMove(OwnerComponent, Params);
 }
 
-void UAIAction_Log::Abort_Implementation()
+void UAIAction_MoveTo::Abort_Implementation(UAIComponent* OwnerComponent)
 {
-    SetRunning(false);
+    APawn* Pawn = OwnerComponent ? OwnerComponent->GetOwnerPawn() : nullptr;
+    if (AAIController* AIController = Pawn ? Cast<AAIController>(Pawn->GetController()) : nullptr)
+    {
+        AIController->StopMovement();
+    }
+
+    if (OwnerComponent)
+    {
+        OwnerComponent->GetMoveState().Reset();
+    }
+}
+
+// ==================== Log ====================
+
+namespace
+{
+    enum ELogParam { LogParam_Message };
+}
+
+void UAIAction_Log::DeclareParams(FEAISActionParamSchema& Schema) const
+{
+    Schema.Add(TEXT("message"), EEAISParamType::String);
+}
+
+EAIActionStatus UAIAction_Log::Execute_Implementation(UAIComponent* OwnerComponent, const FAIActionParams& Params)
+{
+    const FEAISParamValue* Message = GetParam(Params, LogParam_Message);
+    const FString& Text = Message && !Message->Value.StringValue.IsEmpty() ? Message->Value.StringValue : Params.Target;
+
+    UE_LOG(LogTemp, Warning, TEXT("AI_LOG [%s]: %s"), *OwnerComponent->GetOwner()->GetName(), *Text);
+    return EAIActionStatus::Succeeded;
 }
 
 // ==================== Kick ====================
 
-void UAIAction_Kick::Execute_Implementation(UAIComponent* OwnerComponent, const FAIActionParams& Params)
+const FEAISKickBinding& UAIAction_Kick::GetBinding(UClass* PawnClass)
 {
-    if (!OwnerComponent || !OwnerComponent->GetOwnerPawn()) return;
-    APawn* Pawn = OwnerComponent->GetOwnerPawn();
+    if (const FEAISKickBinding* Existing = Bindings.Find(PawnClass))
+    {
+        return *Existing;
+    }
 
-    FVector Direction = Pawn->GetActorForwardVector();
-    float Power = Params.Power;
+    static const FName ExecuteShootName(TEXT("ExecuteShoot"));
 
-    // Use Reflection to call ExecuteShoot(FVector Direction, float Power)
-    UFunction* Function = Pawn->FindFunction(FName(TEXT("ExecuteShoot")));
-    if (Function)
+    FEAISKickBinding& Binding = Bindings.Add(PawnClass);
+    Binding.bNative = PawnClass->ImplementsInterface(UEAIS_KickHandler::StaticClass());
+    if (Binding.bNative)
     {
-        struct FExecuteShootParams
+        return Binding;
+    }
+
+    UFunction* Function = PawnClass->FindFunctionByName(ExecuteShootName);
+    if (!Function)
+    {
+        UE_LOG(LogTemp, Warning, TEXT("UAIAction_Kick: Could not find 'ExecuteShoot' function on %s"), *PawnClass->GetName());
+        return Binding;
+    }
+
+    // Expect exactly (FVector Direction, float/double Power) and no return value
+    FStructProperty* DirectionProperty = nullptr;
+    FNumericProperty* PowerProperty = nullptr;
+    int32 NumParams = 0;
+    for (TFieldIterator<FProperty> It(Function); It && It->HasAnyPropertyFlags(CPF_Parm); ++It)
+    {
+        FProperty* Property = *It;
+        if (NumParams == 0)
+        {
+            FStructProperty* StructProperty = CastField<FStructProperty>(Property);
+            DirectionProperty = StructProperty && StructProperty->Struct == TBaseStructure<FVector>::Get() ? StructProperty : nullptr;
+        }
+        else if (NumParams == 1)
         {
-            FVector Direction;
-            float Power;
-        };
-        FExecuteShootParams FuncParams;
-        FuncParams.Direction = Direction;
-        FuncParams.Power = Power;
-
-        Pawn->ProcessEvent(Function, &FuncParams);
+            FNumericProperty* NumericProperty = CastField<FNumericProperty>(Property);
+            PowerProperty = NumericProperty && NumericProperty->IsFloatingPoint() ? NumericProperty : nullptr;
+        }
+        if (Property->HasAnyPropertyFlags(CPF_ReturnParm | CPF_OutParm) && !Property->HasAnyPropertyFlags(CPF_ConstParm))
+        {
+            NumParams = INDEX_NONE;
+            break;
+        }
+        ++NumParams;
+    }
+
+    if (NumParams != 2 || !DirectionProperty || !PowerProperty)
+    {
+        UE_LOG(LogTemp, Error, TEXT("UAIAction_Kick: %s::ExecuteShoot must be (FVector Direction, float Power); kicks are disabled for this class"),
+            *PawnClass->GetName());
+        return Binding;
+    }
+
+    Binding.Function = Function;
+    Binding.DirectionProperty = DirectionProperty;
+    Binding.PowerProperty = PowerProperty;
+    return Binding;
+}
+
+EAIActionStatus UAIAction_Kick::Execute_Implementation(UAIComponent* OwnerComponent, const FAIActionParams& Params)
+{
+    if (!OwnerComponent || !OwnerComponent->GetOwnerPawn()) return EAIActionStatus::Failed;
+    APawn* Pawn = OwnerComponent->GetOwnerPawn();
+
+    const FVector Direction = Pawn->GetActorForwardVector();
+    const float Power = Params.Power;
+
+    const FEAISKickBinding& Binding = GetBinding(Pawn->GetClass());
+    if (Binding.bNative)
+    {
+        CastChecked<IEAIS_KickHandler>(Pawn)->EAIS_Kick(Direction, Power);
+    }
+    else if (UFunction* Function = Binding.Function.Get())
+    {
+        // Parameters laid out by the validated properties, not a hand-written struct
+        uint8* Parms = static_cast<uint8*>(FMemory_Alloca_Aligned(Function->ParmsSize, Function->GetMinAlignment()));
+        FMemory::Memzero(Parms, Function->ParmsSize);
+        Binding.DirectionProperty->CopyCompleteValue(Binding.DirectionProperty->ContainerPtrToValuePtr<void>(Parms), &Direction);
+        Binding.PowerProperty->SetFloatingPointPropertyValue(Binding.PowerProperty->ContainerPtrToValuePtr<void>(Parms), Power);
+
+        Pawn->ProcessEvent(Function, Parms);
         UE_LOG(LogTemp, Verbose, TEXT("UAIAction_Kick: Invoked ExecuteShoot via reflection"));
     }
     else
     {
-        UE_LOG(LogTemp, Warning, TEXT("UAIAction_Kick: Could not find 'ExecuteShoot' function on pawn %s"), *Pawn->GetName());
+        return EAIActionStatus::Failed;
     }
 
     OwnerComponent->SetBlackboardFloat(TEXT("KickPower"), Params.Power);
+
+    return EAIActionStatus::Succeeded;
 }
 
 // ==================== AimAt ====================
 
-void UAIAction_AimAt::Execute_Implementation(UAIComponent* OwnerComponent, const FAIActionParams& Params)
+EAIActionStatus UAIAction_AimAt::Execute_Implementation(UAIComponent* OwnerComponent, const FAIActionParams& Params)
 {
     if (!OwnerComponent)
     {
-        return;
+        return EAIActionStatus::Failed;
     }
 
     APawn* Pawn = OwnerComponent->GetOwnerPawn();
     if (!Pawn)
     {
-        return;
+        return EAIActionStatus::Failed;
     }
 
     FVector TargetLocation = FVector::ZeroVector;
-    bool bTargetFound = false;
-
-    // 1. Try TargetProvider first (game-specific resolution)
-    if (IEAIS_TargetProvider* TargetProvider = Cast<IEAIS_TargetProvider>(Pawn))
-    {
-        bTargetFound = IEAIS_TargetProvider::Execute_EAIS_GetTargetLocation(Pawn, FName(*Params.Target), TargetLocation);
-    }
-
-    // 2. Fallback to blackboard if TargetProvider didn't handle it
-    if (!bTargetFound)
-    {
-        TargetLocation = OwnerComponent->GetBlackboardVector(Params.Target);
-        bTargetFound = !TargetLocation.IsZero();
-    }
-
-    if (!bTargetFound)
+    if (!ResolveTargetLocation(OwnerComponent, Params, TargetLocation))
     {
         UE_LOG(LogTemp, Warning, TEXT("UAIAction_AimAt: Could not resolve target '%s'"), *Params.Target);
+        return EAIActionStatus::Failed;
     }
 
     // Set focus/aim direction
@@ -246,53 +491,37 @@ void UAIAction_AimAt::Execute_Implementation(UAIComponent* OwnerComponent, const
 
     // Store aim target in blackboard
     OwnerComponent->SetBlackboardVector(TEXT("AimTarget"), TargetLocation);
+
+    return EAIActionStatus::Succeeded;
 }
 
 // ==================== SetLookTarget ====================
 
-void UAIAction_SetLookTarget::Execute_Implementation(UAIComponent* OwnerComponent, const FAIActionParams& Params)
+EAIActionStatus UAIAction_SetLookTarget::Execute_Implementation(UAIComponent* OwnerComponent, const FAIActionParams& Params)
 {
     if (!OwnerComponent)
     {
-        return;
+        return EAIActionStatus::Failed;
     }
 
     APawn* Pawn = OwnerComponent->GetOwnerPawn();
     if (!Pawn)
     {
-        return;
+        return EAIActionStatus::Failed;
     }
 
     AAIController* AIController = Cast<AAIController>(Pawn->GetController());
     if (!AIController)
     {
-        return;
+        return EAIActionStatus::Failed;
     }
 
     if (Params.Target.Equals(TEXT("nearest_enemy"), ESearchCase::IgnoreCase))
     {
-        // Find nearest enemy
-        TArray<AActor*> FoundActors;
-        UGameplayStatics::GetAllActorsWithTag(OwnerComponent->GetWorld(), FName(TEXT("Player")), FoundActors);
-        
-        AActor* Nearest = nullptr;
-        float NearestDist = FLT_MAX;
-        FVector MyLocation = Pawn->GetActorLocation();
-
-        for (AActor* Actor : FoundActors)
-        {
-            if (Actor != Pawn)
-            {
-                float Dist = FVector::Dist(MyLocation, Actor->GetActorLocation());
-                if (Dist < NearestDist)
-                {
-                    NearestDist = Dist;
-                    Nearest = Actor;
-                }
-            }
-        }
-
-        if (Nearest)
+        UEAISSubsystem* Subsystem = UEAISSubsystem::Get(OwnerComponent);
+        FEAISQueryFilter Filter;
+        Filter.Team = EEAISTeamFilter::Enemies;
+        if (AActor* Nearest = Subsystem ? Subsystem->FindNearest(Pawn, Pawn->GetActorLocation(), Filter) : nullptr)
         {
             AIController->SetFocus(Nearest);
         }
@@ -306,11 +535,13 @@ void UAIAction_SetLookTarget::Execute_Implementation(UAIComponent* OwnerComponen
             AIController->SetFocus(FoundActors[0]);
         }
     }
+
+    return EAIActionStatus::Succeeded;
 }
 
 // ==================== Wait ====================
 
-void UAIAction_Wait::Execute_Implementation(UAIComponent* OwnerComponent, const FAIActionParams& Params)
+EAIActionStatus UAIAction_Wait::Execute_Implementation(UAIComponent* OwnerComponent, const FAIActionParams& Params)
 {
     // Wait is passive - the interpreter handles timer-based transitions
     // This action just sets a flag
@@ -318,77 +549,83 @@ void UAIAction_Wait::Execute_Implementation(UAIComponent* OwnerComponent, const
     {
         OwnerComponent->SetBlackboardFloat(TEXT("WaitTime"), Params.Power);
     }
+
+    return EAIActionStatus::Succeeded;
 }
 
 // ==================== SetBlackboardKey ====================
 
-void UAIAction_SetBlackboardKey::Execute_Implementation(UAIComponent* OwnerComponent, const FAIActionParams& Params)
+namespace
+{
+    enum ESetBlackboardKeyParam { SetBlackboardKeyParam_Value };
+}
+
+void UAIAction_SetBlackboardKey::DeclareParams(FEAISActionParamSchema& Schema) const
+{
+    Schema.Add(TEXT("value"), EEAISParamType::Auto);
+}
+
+EAIActionStatus UAIAction_SetBlackboardKey::Execute_Implementation(UAIComponent* OwnerComponent, const FAIActionParams& Params)
 {
     if (!OwnerComponent)
     {
-        return;
+        return EAIActionStatus::Failed;
     }
 
-    // Target is the key name, look for value in ExtraParams
-    FString Key = Params.Target;
-    
-    if (Params.ExtraParams.Contains(TEXT("value")))
+    // Target is the key name; the value's type (bool/float/string) was detected when the entry was prepared
+    if (const FEAISParamValue* Value = GetParam(Params, SetBlackboardKeyParam_Value))
     {
-        FString ValueStr = Params.ExtraParams[TEXT("value")];
-        
-        // Try to detect type
-        if (ValueStr.Equals(TEXT("true"), ESearchCase::IgnoreCase) ||
-            ValueStr.Equals(TEXT("false"), ESearchCase::IgnoreCase))
-        {
-            OwnerComponent->SetBlackboardBool(Key, ValueStr.Equals(TEXT("true"), ESearchCase::IgnoreCase));
-        }
-        else if (ValueStr.IsNumeric())
-        {
-            OwnerComponent->SetBlackboardFloat(Key, FCString::Atof(*ValueStr));
-        }
-        else
-        {
-            OwnerComponent->SetBlackboardValue(Key, FBlackboardValue(ValueStr));
-        }
+        OwnerComponent->SetBlackboardValue(Params.Target, Value->Value);
     }
+
+    return EAIActionStatus::Succeeded;
 }
 
 // ==================== InjectInput ====================
 
-void UAIAction_InjectInput::Execute_Implementation(UAIComponent* OwnerComponent, const FAIActionParams& Params)
+namespace
+{
+    enum EInjectInputParam { InjectInputParam_Trigger };
+}
+
+void UAIAction_InjectInput::DeclareParams(FEAISActionParamSchema& Schema) const
+{
+    Schema.Add(TEXT("trigger"), EEAISParamType::Name);
+}
+
+EAIActionStatus UAIAction_InjectInput::Execute_Implementation(UAIComponent* OwnerComponent, const FAIActionParams& Params)
 {
     if (!OwnerComponent)
     {
-        return;
+        return EAIActionStatus::Failed;
     }
 
     APawn* Pawn = OwnerComponent->GetOwnerPawn();
     if (!Pawn)
     {
-        return;
+        return EAIActionStatus::Failed;
     }
 
     APlayerController* PC = Cast<APlayerController>(Pawn->GetController());
     if (!PC)
     {
-        return;
+        return EAIActionStatus::Failed;
     }
 
     // Target is the action name to inject
-    FName ActionName = FName(*Params.Target);
-    
-    // Check for trigger type in extra params
-    FString TriggerType = TEXT("Triggered");
-    if (Params.ExtraParams.Contains(TEXT("trigger")))
-    {
-        TriggerType = Params.ExtraParams[TEXT("trigger")];
-    }
+    const FName ActionName = Params.GetTargetName();
 
-    if (TriggerType.Equals(TEXT("Started"), ESearchCase::IgnoreCase))
+    // Trigger type (default Triggered); FName compares are case-insensitive
+    static const FName StartedName(TEXT("Started"));
+    static const FName CompletedName(TEXT("Completed"));
+    const FEAISParamValue* Trigger = GetParam(Params, InjectInputParam_Trigger);
+    const FName TriggerType = Trigger ? Trigger->Name : NAME_None;
+
+    if (TriggerType == StartedName)
     {
         UCPP_BPL_InputBinding::InjectActionStarted(PC, ActionName);
     }
-    else if (TriggerType.Equals(TEXT("Completed"), ESearchCase::IgnoreCase))
+    else if (TriggerType == CompletedName)
     {
         UCPP_BPL_InputBinding::InjectActionCompleted(PC, ActionName);
     }
@@ -396,80 +633,71 @@ void UAIAction_InjectInput::Execute_Implementation(UAIComponent* OwnerComponent,
     {
         UCPP_BPL_InputBinding::InjectActionTriggered(PC, ActionName);
     }
+
+    return EAIActionStatus::Succeeded;
 }
 
 // ==================== PassToTeammate ====================
 
-void UAIAction_PassToTeammate::Execute_Implementation(UAIComponent* OwnerComponent, const FAIActionParams& Params)
+EAIActionStatus UAIAction_PassToTeammate::Execute_Implementation(UAIComponent* OwnerComponent, const FAIActionParams& Params)
 {
     if (!OwnerComponent)
     {
-        return;
+        return EAIActionStatus::Failed;
     }
 
     APawn* Pawn = OwnerComponent->GetOwnerPawn();
     if (!Pawn)
     {
-        return;
+        return EAIActionStatus::Failed;
     }
 
-    // Find nearest teammate
-    TArray<AActor*> FoundActors;
-    UGameplayStatics::GetAllActorsWithTag(OwnerComponent->GetWorld(), FName(TEXT("Player")), FoundActors);
-
-    AActor* NearestTeammate = nullptr;
-    float NearestDist = FLT_MAX;
-    FVector MyLocation = Pawn->GetActorLocation();
-
-    // Get my team from blackboard
-    FString MyTeam = OwnerComponent->GetBlackboardValue(TEXT("Team")).StringValue;
+    UEAISSubsystem* Subsystem = UEAISSubsystem::Get(OwnerComponent);
+    if (!Subsystem)
+    {
+        return EAIActionStatus::Failed;
+    }
 
-    for (AActor* Actor : FoundActors)
+    // Find nearest teammate (team ids cached by the subsystem)
+    FEAISQueryFilter Filter;
+    Filter.Team = EEAISTeamFilter::Allies;
+    AActor* NearestTeammate = Subsystem->FindNearest(Pawn, Pawn->GetActorLocation(), Filter);
+    if (!NearestTeammate)
     {
-        if (Actor != Pawn)
-        {
-            // TODO: Check if same team
-            float Dist = FVector::Dist(MyLocation, Actor->GetActorLocation());
-            if (Dist < NearestDist)
-            {
-                NearestDist = Dist;
-                NearestTeammate = Actor;
-            }
-        }
+        return EAIActionStatus::Failed;
     }
 
-    if (NearestTeammate)
+    // Aim at teammate and kick
+    AAIController* AIController = Cast<AAIController>(Pawn->GetController());
+    if (AIController)
     {
-        // Aim at teammate and kick
-        AAIController* AIController = Cast<AAIController>(Pawn->GetController());
-        if (AIController)
-        {
-            AIController->SetFocus(NearestTeammate);
-        }
+        AIController->SetFocus(NearestTeammate);
+    }
 
-        // Inject kick with lower power
-        APlayerController* PC = Cast<APlayerController>(Pawn->GetController());
-        if (PC)
-        {
-            OwnerComponent->SetBlackboardFloat(TEXT("KickPower"), 0.5f);
-            UCPP_BPL_InputBinding::InjectActionTriggered(PC, FName(TEXT("Kick")));
-        }
+    // Inject kick with lower power
+    APlayerController* PC = Cast<APlayerController>(Pawn->GetController());
+    if (PC)
+    {
+        OwnerComponent->SetBlackboardFloat(TEXT("KickPower"), 0.5f);
+        UCPP_BPL_InputBinding::InjectActionTriggered(PC, FName(TEXT("Kick")));
     }
+
+    return EAIActionStatus::Succeeded;
 }
 
 // ==================== LookAround ====================
 
-void UAIAction_LookAround::Execute_Implementation(UAIComponent* OwnerComponent, const FAIActionParams& Params)
+EAIActionStatus UAIAction_LookAround::Execute_Implementation(UAIComponent* OwnerComponent, const FAIActionParams& Params)
 {
     if (!OwnerComponent)
     {
-        return;
+        return EAIActionStatus::Failed;
     }
 
     APawn* Pawn = OwnerComponent->GetOwnerPawn();
     if (!Pawn)
     {
-        return;
+        return EAIActionStatus::Failed;
     }
 
     AAIController* AIController = Cast<AAIController>(Pawn->GetController());
@@ -478,68 +706,63 @@ void UAIAction_LookAround::Execute_Implementation(UAIComponent* OwnerComponent,
         // Clear focus to look around freely
         AIController->ClearFocus(EAIFocusPriority::Gameplay);
     }
+
+    return EAIActionStatus::Succeeded;
 }
 
 // ==================== Execute ====================
 
-void UAIAction_Execute::Execute_Implementation(UAIComponent* OwnerComponent, const FAIActionParams& Params)
+EAIActionStatus UAIAction_Execute::Execute_Implementation(UAIComponent* OwnerComponent, const FAIActionParams& Params)
 {
-    if (!OwnerComponent) return;
-    AActor* Owner = OwnerComponent->GetOwner();
-    if (!Owner) return;
+    if (!OwnerComponent) return EAIActionStatus::Failed;
 
-    // Look for ActionExecutor in owner actor components
-    IEAIS_ActionExecutor* Executor = Cast<IEAIS_ActionExecutor>(Owner);
+    // The owner itself or one of its components (resolved once per agent)
+    UObject* Executor = OwnerComponent->GetActionExecutor();
     if (!Executor)
     {
-        // Try components
-        TArray<UActorComponent*> Components;
-        Owner->GetComponents(Components);
-        for (UActorComponent* Comp : Components)
-        {
-            if (Comp->GetClass()->ImplementsInterface(UEAIS_ActionExecutor::StaticClass()))
-            {
-                Executor = Cast<IEAIS_ActionExecutor>(Comp);
-                break;
-            }
-        }
+        UE_LOG(LogTemp, Warning, TEXT("UAIAction_Execute: No IEAIS_ActionExecutor found on %s"), *GetNameSafe(OwnerComponent->GetOwner()));
+        return EAIActionStatus::Failed;
     }
 
-    if (Executor)
+    // Compiled programs prebuild the forwarded params; params built at runtime fall back
+    if (Params.InnerParams.IsValid())
     {
-        // Construct Inner Params for the action being executed
-        FAIActionParams InnerParams;
-        
-        // Populate InnerParams from the ExtraParams of the Execute action
-        // This assumes the Parser has flattened necessary nested params into ExtraParams
-        if (Params.ExtraParams.Contains(TEXT("target")))
-        {
-            InnerParams.Target = Params.ExtraParams[TEXT("target")];
-        }
-        
-        if (Params.ExtraParams.Contains(TEXT("power")))
-        {
-            InnerParams.Power = FCString::Atof(*Params.ExtraParams[TEXT("power")]);
-        }
-        else
-        {
-            // Default power passed down? Or use default 1.0
-            InnerParams.Power = 1.0f;
-        }
+        IEAIS_ActionExecutor::Execute_EAIS_ExecuteAction(Executor, Params.GetTargetName(), *Params.InnerParams);
+    }
+    else
+    {
+        IEAIS_ActionExecutor::Execute_EAIS_ExecuteAction(Executor, Params.GetTargetName(), EAIS::MakeExecuteInnerParams(Params));
+    }
 
-        // Copy all ExtraParams to InnerParams.ExtraParams so the callee has access to everything
-        InnerParams.ExtraParams = Params.ExtraParams;
+    return EAIActionStatus::Succeeded;
+}
 
-        // Remove the mapped keys to avoid confusion? No, keep them for flexibility.
+// ==================== RunQuery ====================
 
-        // Pass the actual object that implements the interface (either the Owner or the Component)
-        UObject* ImplementingObject = Cast<UObject>(Executor);
-        IEAIS_ActionExecutor::Execute_EAIS_ExecuteAction(ImplementingObject, FName(*Params.Target), InnerParams);
-    }
-    else
+EAIActionStatus UAIAction_RunQuery::Execute_Implementation(UAIComponent* OwnerComponent, const FAIActionParams& Params)
+{
+    UEAISSubsystem* Subsystem = UEAISSubsystem::Get(OwnerComponent);
+    const TSharedPtr<const FEAISCompiledProgram>& Program = OwnerComponent ? OwnerComponent->GetInterpreter().GetProgram() : nullptr;
+    const int32 QueryIndex = Program.IsValid() ? Program->FindQuery(Params.Target) : INDEX_NONE;
+    if (!Subsystem || QueryIndex == INDEX_NONE)
     {
-        UE_LOG(LogTemp, Warning, TEXT("UAIAction_Execute: No IEAIS_ActionExecutor found on %s"), *Owner->GetName());
+        UE_LOG(LogTemp, Warning, TEXT("UAIAction_RunQuery: Unknown query '%s'"), *Params.Target);
+        return EAIActionStatus::Failed;
     }
 
-    Complete();
+    return Subsystem->RequestScoringQuery(OwnerComponent, QueryIndex);
+}
+
+EAIActionStatus UAIAction_RunQuery::TickAction_Implementation(UAIComponent* OwnerComponent, const FAIActionParams& Params, float DeltaSeconds)
+{
+    return OwnerComponent ? OwnerComponent->GetScoringState().Status : EAIActionStatus::Failed;
+}
+
+void UAIAction_RunQuery::Abort_Implementation(UAIComponent* OwnerComponent)
+{
+    // Clearing the serial drops the in-flight result
+    if (OwnerComponent)
+    {
+        OwnerComponent->GetScoringState().Reset();
+    }
 }
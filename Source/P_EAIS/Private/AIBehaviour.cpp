@@ -23,6 +23,7 @@ static void ParseConditionInternal(const TSharedPtr<FJsonObject>& CondObj, FAICo
         else if (TypeStr.Equals(TEXT("And"), ESearchCase::IgnoreCase)) OutCond.Type = EAIConditionType::And;
         else if (TypeStr.Equals(TEXT("Or"), ESearchCase::IgnoreCase)) OutCond.Type = EAIConditionType::Or;
         else if (TypeStr.Equals(TEXT("Not"), ESearchCase::IgnoreCase)) OutCond.Type = EAIConditionType::Not;
+        else if (TypeStr.Equals(TEXT("Action"), ESearchCase::IgnoreCase)) OutCond.Type = EAIConditionType::Action;
         else OutCond.Type = EAIConditionType::Blackboard;
     }
 
@@ -98,6 +99,11 @@ static void ParseActionParamsInternal(const TSharedPtr<FJsonObject>& ParamsObj,
     else if (ParamsObj->HasField(TEXT("speed"))) OutParams.Power = ParamsObj->GetNumberField(TEXT("speed"));
     else if (ParamsObj->HasField(TEXT("Speed"))) OutParams.Power = ParamsObj->GetNumberField(TEXT("Speed"));
 
+    // Move request thresholds
+    ParamsObj->TryGetNumberField(TEXT("acceptanceRadius"), OutParams.AcceptanceRadius);
+    ParamsObj->TryGetNumberField(TEXT("retargetDistance"), OutParams.RetargetDistance);
+    ParamsObj->TryGetNumberField(TEXT("retargetInterval"), OutParams.RetargetInterval);
+
     // Flatten all fields to ExtraParams
     for (const auto& Pair : ParamsObj->Values)
     {
@@ -123,6 +129,111 @@ static void ParseActionParamsInternal(const TSharedPtr<FJsonObject>& ParamsObj,
     }
 }
 
+bool UAIBehaviour::ParseQueryJson(const TSharedPtr<FJsonObject>& QueryObj, FEAISQueryDef& OutQuery)
+{
+    if (!QueryObj.IsValid() || !QueryObj->TryGetStringField(TEXT("name"), OutQuery.Name) || OutQuery.Name.IsEmpty())
+    {
+        UE_LOG(LogTemp, Warning, TEXT("AIBehaviour: Query without 'name' ignored."));
+        return false;
+    }
+
+    FString GeneratorStr;
+    if (QueryObj->TryGetStringField(TEXT("generator"), GeneratorStr))
+    {
+        if (GeneratorStr.Equals(TEXT("Enemies"), ESearchCase::IgnoreCase)) OutQuery.Generator = EEAISQueryGenerator::Enemies;
+        else if (GeneratorStr.Equals(TEXT("Grid"), ESearchCase::IgnoreCase)) OutQuery.Generator = EEAISQueryGenerator::Grid;
+        else if (GeneratorStr.Equals(TEXT("Allies"), ESearchCase::IgnoreCase)) OutQuery.Generator = EEAISQueryGenerator::Allies;
+        else UE_LOG(LogTemp, Warning, TEXT("AIBehaviour: Query '%s' has unknown generator '%s', using Allies."), *OutQuery.Name, *GeneratorStr);
+    }
+
+    FString RoleStr;
+    if (QueryObj->TryGetStringField(TEXT("role"), RoleStr) && !RoleStr.IsEmpty())
+    {
+        OutQuery.Role = FName(*RoleStr);
+    }
+    QueryObj->TryGetNumberField(TEXT("gridRadius"), OutQuery.GridRadius);
+    QueryObj->TryGetNumberField(TEXT("gridSpacing"), OutQuery.GridSpacing);
+    OutQuery.GridSpacing = FMath::Max(OutQuery.GridSpacing, 10.0f);
+    QueryObj->TryGetStringField(TEXT("result"), OutQuery.ResultKey);
+
+    const TArray<TSharedPtr<FJsonValue>>* TestsArray = nullptr;
+    if (QueryObj->TryGetArrayField(TEXT("tests"), TestsArray))
+    {
+        for (const TSharedPtr<FJsonValue>& TestVal : *TestsArray)
+        {
+            const TSharedPtr<FJsonObject> TestObj = TestVal->AsObject();
+            if (!TestObj.IsValid()) continue;
+
+            FEAISQueryTest Test;
+            const FString TypeStr = TestObj->GetStringField(TEXT("type"));
+            if (TypeStr.Equals(TEXT("Dot"), ESearchCase::IgnoreCase)) Test.Type = EEAISQueryTestType::Dot;
+            else if (TypeStr.Equals(TEXT("LineOfSight"), ESearchCase::IgnoreCase)) Test.Type = EEAISQueryTestType::LineOfSight;
+            else if (TypeStr.Equals(TEXT("Distance"), ESearchCase::IgnoreCase)) Test.Type = EEAISQueryTestType::Distance;
+            else
+            {
+                UE_LOG(LogTemp, Warning, TEXT("AIBehaviour: Query '%s' has unknown test '%s', ignored."), *OutQuery.Name, *TypeStr);
+                continue;
+            }
+
+            TestObj->TryGetNumberField(TEXT("min"), Test.Min);
+            TestObj->TryGetNumberField(TEXT("max"), Test.Max);
+            TestObj->TryGetNumberField(TEXT("weight"), Test.Weight);
+            TestObj->TryGetBoolField(TEXT("filter"), Test.bFilter);
+            OutQuery.Tests.Add(Test);
+        }
+    }
+
+    return true;
+}
+
+TSharedRef<FJsonObject> UAIBehaviour::QueryToJson(const FEAISQueryDef& Query)
+{
+    TSharedRef<FJsonObject> QueryObj = MakeShared<FJsonObject>();
+    QueryObj->SetStringField(TEXT("name"), Query.Name);
+
+    switch (Query.Generator)
+    {
+    case EEAISQueryGenerator::Enemies: QueryObj->SetStringField(TEXT("generator"), TEXT("Enemies")); break;
+    case EEAISQueryGenerator::Grid: QueryObj->SetStringField(TEXT("generator"), TEXT("Grid")); break;
+    default: QueryObj->SetStringField(TEXT("generator"), TEXT("Allies")); break;
+    }
+
+    if (!Query.Role.IsNone())
+    {
+        QueryObj->SetStringField(TEXT("role"), Query.Role.ToString());
+    }
+    if (Query.Generator == EEAISQueryGenerator::Grid)
+    {
+        QueryObj->SetNumberField(TEXT("gridRadius"), Query.GridRadius);
+        QueryObj->SetNumberField(TEXT("gridSpacing"), Query.GridSpacing);
+    }
+    QueryObj->SetStringField(TEXT("result"), Query.ResultKey);
+
+    TArray<TSharedPtr<FJsonValue>> TestsArray;
+    for (const FEAISQueryTest& Test : Query.Tests)
+    {
+        TSharedRef<FJsonObject> TestObj = MakeShared<FJsonObject>();
+        switch (Test.Type)
+        {
+        case EEAISQueryTestType::Dot: TestObj->SetStringField(TEXT("type"), TEXT("Dot")); break;
+        case EEAISQueryTestType::LineOfSight: TestObj->SetStringField(TEXT("type"), TEXT("LineOfSight")); break;
+        default: TestObj->SetStringField(TEXT("type"), TEXT("Distance")); break;
+        }
+
+        TestObj->SetNumberField(TEXT("min"), Test.Min);
+        TestObj->SetNumberField(TEXT("max"), Test.Max);
+        TestObj->SetNumberField(TEXT("weight"), Test.Weight);
+        if (Test.bFilter)
+        {
+            TestObj->SetBoolField(TEXT("filter"), true);
+        }
+        TestsArray.Add(MakeShared<FJsonValueObject>(TestObj));
+    }
+    QueryObj->SetArrayField(TEXT("tests"), TestsArray);
+
+    return QueryObj;
+}
+
 UAIBehaviour::UAIBehaviour()
 {
     BehaviorName = TEXT("NewBehavior");
@@ -152,10 +263,18 @@ bool UAIBehaviour::ParseBehavior(FString& OutError)
     {
         OutError = TEXT("No JSON content available");
         ParsedBehavior.bIsValid = false;
+        CompiledProgram.Reset();
         return false;
     }
 
-    return ParseJsonInternal(JsonContent, ParsedBehavior, OutError);
+    if (!ParseJsonInternal(JsonContent, ParsedBehavior, OutError))
+    {
+        CompiledProgram.Reset();
+        return false;
+    }
+
+    CompiledProgram = FEAISCompiledProgram::Compile(ParsedBehavior);
+    return true;
 }
 
 bool UAIBehaviour::ReloadFromFile(FString& OutError)
@@ -223,6 +342,14 @@ bool UAIBehaviour::ParseJsonInternal(const FString& JsonString, FAIBehaviorDef&
         UE_LOG(LogTemp, Warning, TEXT("AIBehaviour: JSON missing 'name' field. Using fallback."));
     }
 
+    // Parse transition chaining limit (opt-in)
+    int32 MaxTransitions = 1;
+    if (RootObject->TryGetNumberField(TEXT("maxTransitionsPerTick"), MaxTransitions) ||
+        RootObject->TryGetNumberField(TEXT("MaxTransitionsPerTick"), MaxTransitions))
+    {
+        OutDef.MaxTransitionsPerTick = FMath::Max(1, MaxTransitions);
+    }
+
     // Parse blackboard (can be Object or Array format)
     TSharedPtr<FJsonObject> BlackboardObj;
     const TArray<TSharedPtr<FJsonValue>>* BlackboardArray = nullptr;
@@ -341,6 +468,20 @@ bool UAIBehaviour::ParseJsonInternal(const FString& JsonString, FAIBehaviorDef&
         }
     }
 
+    // Parse scoring queries
+    const TArray<TSharedPtr<FJsonValue>>* QueriesArray = nullptr;
+    if (RootObject->TryGetArrayField(TEXT("queries"), QueriesArray))
+    {
+        for (const TSharedPtr<FJsonValue>& QueryVal : *QueriesArray)
+        {
+            FEAISQueryDef Query;
+            if (ParseQueryJson(QueryVal->AsObject(), Query))
+            {
+                OutDef.Queries.Add(Query);
+            }
+        }
+    }
+
     // Parse states
     const TArray<TSharedPtr<FJsonValue>>* StatesArray = nullptr;
     if (RootObject->HasTypedField<EJson::Array>(TEXT("states")))
@@ -6,6 +6,11 @@
 
 #include "AIComponent.h"
 #include "AIBehaviour.h"
+#include "EAISSubsystem.h"
+#include "EAISSettings.h"
+#include "EAIS_ProfileUtils.h"
+#include "EAIS_ActionExecutor.h"
+#include "EAIS_TargetProvider.h"
 #include "GameFramework/Pawn.h"
 #include "GameFramework/Controller.h"
 #include "Net/UnrealNetwork.h"
@@ -21,13 +26,39 @@ void UAIComponent::BeginPlay()
     Super::BeginPlay();
 
     // Bind to interpreter events
-    Interpreter.OnStateChanged.AddDynamic(this, &UAIComponent::HandleStateChanged);
+    Interpreter.OnStateChanged.AddUObject(this, &UAIComponent::HandleStateChanged);
+    Interpreter.OnActionExecuted.AddUObject(this, &UAIComponent::HandleActionExecuted);
+
+    // Team/role are cached once per pawn so team queries never call the provider;
+    // "team."/"global." keys are bound before the first state is entered
+    UEAISSubsystem* Subsystem = UEAISSubsystem::Get(this);
+    if (Subsystem)
+    {
+        UpdateQueryActor();
+    }
+    if (AController* Controller = Cast<AController>(GetOwner()))
+    {
+        Controller->OnPossessedPawnChanged.AddDynamic(this, &UAIComponent::HandlePossessedPawnChanged);
+    }
 
     // Initialize from asset or JSON file
     if (AIBehaviour)
     {
         InitializeAI(AIBehaviour);
     }
+    else if (!JsonFilePath.IsEmpty() && Subsystem)
+    {
+        // Cached per path by the subsystem, so respawns do not re-read or re-parse the file
+        UAIBehaviour* Behavior = Subsystem->LoadBehaviorFromFile(JsonFilePath);
+        if (Behavior)
+        {
+            InitializeAI(Behavior);
+        }
+        else
+        {
+            UE_LOG(LogTemp, Warning, TEXT("UAIComponent: Failed to load behavior file '%s'"), *JsonFilePath);
+        }
+    }
     else if (!JsonFilePath.IsEmpty())
     {
         FString FullPath = FPaths::ProjectContentDir() / TEXT("AIProfiles") / JsonFilePath;
@@ -47,31 +78,150 @@ void UAIComponent::BeginPlay()
     {
         StartAI();
     }
+
+    // Hand ticking over to the subsystem scheduler when it is enabled
+    if (Subsystem)
+    {
+        bScheduledBySubsystem = Subsystem->RegisterAgent(this);
+        if (bScheduledBySubsystem)
+        {
+            SetComponentTickEnabled(false);
+        }
+    }
+}
+
+void UAIComponent::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+    // Waiting listeners unbind from the interpreter while it still belongs to this component
+    OnEndPlayNative.Broadcast();
+
+    if (AController* Controller = Cast<AController>(GetOwner()))
+    {
+        Controller->OnPossessedPawnChanged.RemoveDynamic(this, &UAIComponent::HandlePossessedPawnChanged);
+    }
+
+    if (UEAISSubsystem* Subsystem = UEAISSubsystem::Get(this))
+    {
+        Subsystem->UnregisterQueryActor(QueryActor.Get());
+        if (bScheduledBySubsystem)
+        {
+            Subsystem->UnregisterAgent(this);
+        }
+
+        // Respawned agents on the same profile reuse this interpreter's storage (running actions are aborted)
+        Subsystem->ReleaseInterpreter(Interpreter);
+    }
+    bIsRunning = false;
+    QueryActor = nullptr;
+    bScheduledBySubsystem = false;
+
+    Super::EndPlay(EndPlayReason);
+}
+
+void UAIComponent::UpdateQueryActor()
+{
+    UEAISSubsystem* Subsystem = UEAISSubsystem::Get(this);
+    if (!Subsystem)
+    {
+        return;
+    }
+
+    AActor* Pawn = GetOwnerPawn();
+    if (Pawn != QueryActor.Get())
+    {
+        Subsystem->UnregisterQueryActor(QueryActor.Get());
+        QueryActor = Pawn;
+        Subsystem->RegisterQueryActor(Pawn);
+    }
+
+    // Rebinds to the new pawn's team (team 0 without a pawn)
+    Subsystem->BindSharedBlackboards(this);
+}
+
+void UAIComponent::HandlePossessedPawnChanged(APawn* OldPawn, APawn* NewPawn)
+{
+    UpdateQueryActor();
 }
 
 void UAIComponent::TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction)
 {
     Super::TickComponent(DeltaTime, TickType, ThisTickFunction);
 
-    if (!bIsRunning || !ShouldRun())
+    if (!CanTickAI())
     {
         return;
     }
 
-    // Handle tick interval
-    if (TickInterval > 0.0f)
+    // Accumulate skipped frames so the interpreter sees the full elapsed time (Timer conditions stay exact)
+    AccumulateTickTime(DeltaTime);
+
+    const UEAISSettings* Settings = GetDefault<UEAISSettings>();
+    if (Settings->bUseFixedTimestep)
     {
-        TimeSinceLastTick += DeltaTime;
-        if (TimeSinceLastTick < TickInterval)
+        const float StepSeconds = GetFixedStepSeconds(1.0f / FMath::Max(Settings->FixedTickRate, 1.0f));
+        const int32 NumSteps = ConsumeFixedSteps(StepSeconds, FMath::Max(Settings->MaxSubstepsPerFrame, 1));
+        for (int32 Step = 0; Step < NumSteps; ++Step)
+        {
+            TickAI(StepSeconds);
+        }
+        if (NumSteps > 0)
         {
-            return;
+            DispatchBlackboardChanges();
         }
+        return;
+    }
 
-        DeltaTime = TimeSinceLastTick;
-        TimeSinceLastTick = 0.0f;
+    if (IsTickDue())
+    {
+        TickAI(ConsumeTickTime());
+        DispatchBlackboardChanges();
     }
+}
+
+float UAIComponent::ConsumeTickTime()
+{
+    const float Elapsed = TimeSinceLastTick;
+    TimeSinceLastTick = 0.0f;
+    DeferredTickFrames = 0;
+    bWakeRequested = false;
+    return Elapsed;
+}
 
-    Interpreter.Tick(DeltaTime);
+float UAIComponent::GetFixedStepSeconds(float BaseStepSeconds) const
+{
+    // Slower agents (TickInterval / LOD) take longer steps, but always whole multiples of the base step
+    const int32 Multiple = FMath::Max(1, FMath::CeilToInt(GetEffectiveTickInterval() / BaseStepSeconds - UE_KINDA_SMALL_NUMBER));
+    return BaseStepSeconds * Multiple;
+}
+
+int32 UAIComponent::ConsumeFixedSteps(float StepSeconds, int32 MaxSteps)
+{
+    int32 NumSteps = FMath::FloorToInt(TimeSinceLastTick / StepSeconds);
+    if (NumSteps == 0 && bWakeRequested)
+    {
+        // Borrow one step; the accumulator goes negative and the next step waits correspondingly
+        NumSteps = 1;
+    }
+
+    if (NumSteps > MaxSteps)
+    {
+        // Drop the backlog instead of spiralling after a hitch; keep the phase within the step
+        NumSteps = MaxSteps;
+        TimeSinceLastTick = FMath::Fmod(TimeSinceLastTick, StepSeconds);
+    }
+    else
+    {
+        TimeSinceLastTick -= NumSteps * StepSeconds;
+    }
+
+    DeferredTickFrames = 0;
+    bWakeRequested = false;
+    return NumSteps;
+}
+
+void UAIComponent::TickAI(float DeltaSeconds)
+{
+    Interpreter.Tick(DeltaSeconds);
 }
 
 bool UAIComponent::InitializeAI(UAIBehaviour* Behavior)
@@ -81,30 +231,42 @@ bool UAIComponent::InitializeAI(UAIBehaviour* Behavior)
         return false;
     }
 
-    UE_LOG(LogTemp, Warning, TEXT("UAIComponent: InitializeAI called for %s"), *Behavior->GetName());
+    UE_LOG(LogTemp, Verbose, TEXT("UAIComponent: InitializeAI called for %s"), *Behavior->GetName());
     AIBehaviour = Behavior;
 
+    // Parse only once per behavior so every agent shares the same compiled program
     FString Error;
-    if (!Behavior->ParseBehavior(Error))
+    if (!Behavior->GetCompiledProgram().IsValid() && !Behavior->ParseBehavior(Error))
     {
         UE_LOG(LogTemp, Error, TEXT("UAIComponent: Failed to parse behavior: %s"), *Error);
         return false;
     }
 
-    if (!Interpreter.LoadFromDef(Behavior->GetBehaviorDef()))
+    // Same program: Initialize below resets per-agent state. Otherwise take pooled storage for the new program.
+    const TSharedPtr<const FEAISCompiledProgram>& Program = Behavior->GetCompiledProgram();
+    if (Interpreter.GetProgram() != Program)
     {
-        UE_LOG(LogTemp, Error, TEXT("UAIComponent: Failed to load interpreter definition"));
-        return false;
+        UEAISSubsystem* Subsystem = UEAISSubsystem::Get(this);
+        if (Subsystem)
+        {
+            Subsystem->ReleaseInterpreter(Interpreter);
+        }
+
+        if (!(Subsystem && Subsystem->AcquireInterpreter(Program, Interpreter)) && !Interpreter.LoadFromProgram(Program))
+        {
+            UE_LOG(LogTemp, Error, TEXT("UAIComponent: Failed to load interpreter definition"));
+            return false;
+        }
     }
 
     Interpreter.Initialize(this);
-    UE_LOG(LogTemp, Warning, TEXT("UAIComponent: AI initialized successfully."));
+    UE_LOG(LogTemp, Verbose, TEXT("UAIComponent: AI initialized successfully."));
     return true;
 }
 
 bool UAIComponent::InitializeAIFromJson(const FString& JsonString, FString& OutError)
 {
-    UE_LOG(LogTemp, Warning, TEXT("UAIComponent: InitializeAIFromJson called. Length: %d"), JsonString.Len());
+    UE_LOG(LogTemp, Verbose, TEXT("UAIComponent: InitializeAIFromJson called. Length: %d"), JsonString.Len());
     if (!Interpreter.LoadFromJson(JsonString, OutError))
     {
         UE_LOG(LogTemp, Error, TEXT("UAIComponent: Failed to load from JSON: %s"), *OutError);
@@ -112,13 +274,10 @@ bool UAIComponent::InitializeAIFromJson(const FString& JsonString, FString& OutE
     }
 
     Interpreter.Initialize(this);
-    UE_LOG(LogTemp, Warning, TEXT("UAIComponent: AI initialized from JSON successfully."));
+    UE_LOG(LogTemp, Verbose, TEXT("UAIComponent: AI initialized from JSON successfully."));
     return true;
 }
 
-#include "EAIS_ProfileUtils.h"
-#include "EAISSubsystem.h"
-
 void UAIComponent::StartAI(const FString& ProfileName, const FString& OptionalPath)
 {
     if (!ProfileName.IsEmpty())
@@ -153,7 +312,10 @@ void UAIComponent::StartAI(const FString& ProfileName, const FString& OptionalPa
     bIsRunning = true;
     Interpreter.SetPaused(false);
 
-    UE_LOG(LogTemp, Warning, TEXT("UAIComponent: AI Started - %s (State: %s)"), *GetBehaviorName(), *GetCurrentState());
+    if (bDebugMode)
+    {
+        UE_LOG(LogTemp, Log, TEXT("UAIComponent: AI Started - %s (State: %s)"), *GetBehaviorName(), *GetCurrentState());
+    }
 }
 
 void UAIComponent::StopAI()
@@ -161,6 +323,10 @@ void UAIComponent::StopAI()
     bIsRunning = false;
     Interpreter.SetPaused(true);
 
+    // Stopped agents should not keep moving/acting; OnTick actions restart on StartAI
+    Interpreter.AbortRunningActions();
+    TargetCache.Reset();
+
     if (bDebugMode)
     {
         UE_LOG(LogTemp, Log, TEXT("UAIComponent: AI Stopped - %s"), *GetBehaviorName());
@@ -186,12 +352,36 @@ bool UAIComponent::ForceTransition(const FString& StateId)
 void UAIComponent::EnqueueEvent(const FString& EventName, const FAIEventPayload& Payload)
 {
     Interpreter.EnqueueEvent(EventName, Payload);
+
+    if (Payload.bUrgent)
+    {
+        RequestWake();
+    }
 }
 
-void UAIComponent::EnqueueSimpleEvent(const FString& EventName)
+void UAIComponent::EnqueueSimpleEvent(const FString& EventName, bool bUrgent)
 {
     FAIEventPayload Payload;
-    Interpreter.EnqueueEvent(EventName, Payload);
+    Payload.bUrgent = bUrgent;
+    EnqueueEvent(EventName, Payload);
+}
+
+bool UAIComponent::HandleInputAction(FName InputAction, bool bUrgent)
+{
+    // Mapped at compile time, so routing is one FName lookup with no string work
+    const TSharedPtr<const FEAISCompiledProgram>& Program = Interpreter.GetProgram();
+    const int32 EventId = Program.IsValid() ? Program->FindInputEvent(InputAction) : INDEX_NONE;
+    if (EventId == INDEX_NONE)
+    {
+        return false;
+    }
+
+    Interpreter.EnqueueEventId(EventId);
+    if (bUrgent)
+    {
+        RequestWake();
+    }
+    return true;
 }
 
 void UAIComponent::SetBlackboardValue(const FString& Key, const FBlackboardValue& Value)
@@ -246,6 +436,38 @@ UObject* UAIComponent::GetBlackboardObject(const FString& Key) const
     return Interpreter.GetBlackboardObject(Key);
 }
 
+bool UAIComponent::ResolveBlackboardKey(FEAISBlackboardKeyHandle& Handle) const
+{
+    return Interpreter.ResolveKeyHandle(Handle);
+}
+
+FEAISBlackboardKeyHandle UAIComponent::MakeBlackboardKeyHandle(const FString& Key, EBlackboardValueType Type) const
+{
+    FEAISBlackboardKeyHandle Handle(Key, Type);
+    Interpreter.ResolveKeyHandle(Handle);
+    return Handle;
+}
+
+void UAIComponent::ObserveBlackboardKey(const FString& Key, FOnAIBlackboardKeyChanged OnChanged)
+{
+    if (Key.IsEmpty() || !OnChanged.IsBound())
+    {
+        return;
+    }
+
+    // Bound weakly to the listener so StopObservingBlackboard can find it and a destroyed listener is skipped
+    Interpreter.ObserveBlackboardKey(Key, FOnEAISBlackboardChanged::FDelegate::CreateWeakLambda(OnChanged.GetUObject(),
+        [OnChanged](const FString& ChangedKey, const FBlackboardValue& Value)
+        {
+            OnChanged.ExecuteIfBound(ChangedKey, Value);
+        }));
+}
+
+void UAIComponent::StopObservingBlackboard(UObject* Listener, const FString& Key)
+{
+    Interpreter.RemoveBlackboardObservers(Listener, Key);
+}
+
 FString UAIComponent::GetCurrentState() const
 {
     return Interpreter.GetCurrentStateId();
@@ -276,6 +498,108 @@ TArray<FString> UAIComponent::GetAllStates() const
     return Interpreter.GetAllStateIds();
 }
 
+UObject* UAIComponent::GetActionExecutor()
+{
+    AActor* Owner = GetOwner();
+    if (!Owner)
+    {
+        return nullptr;
+    }
+
+    // Only hits are cached: a miss re-resolves, so an executor added later is picked up
+    if (UObject* Cached = CachedActionExecutor.Get())
+    {
+        return Cached;
+    }
+
+    if (Owner->Implements<UEAIS_ActionExecutor>())
+    {
+        CachedActionExecutor = Owner;
+    }
+    else
+    {
+        for (UActorComponent* Component : Owner->GetComponents())
+        {
+            if (Component && Component->Implements<UEAIS_ActionExecutor>())
+            {
+                CachedActionExecutor = Component;
+                break;
+            }
+        }
+    }
+
+    return CachedActionExecutor.Get();
+}
+
+namespace
+{
+    /** Targets not asked for within this many seconds are not refreshed any more */
+    constexpr double TargetCacheKeepSeconds = 1.0;
+}
+
+bool UAIComponent::ResolveProviderTarget(FName TargetId, FVector& OutLocation)
+{
+    APawn* Pawn = GetOwnerPawn();
+    UWorld* World = GetWorld();
+    if (!Pawn || !World || TargetId.IsNone() || !Pawn->Implements<UEAIS_TargetProvider>())
+    {
+        return false;
+    }
+
+    const double Now = World->GetTimeSeconds();
+    const float TTL = GetDefault<UEAISSettings>()->TargetCacheTTL;
+
+    int32 Index = TargetCache.IndexOfByPredicate([TargetId](const FEAISTargetCacheEntry& Entry) { return Entry.TargetId == TargetId; });
+    if (Index == INDEX_NONE)
+    {
+        Index = TargetCache.AddDefaulted();
+        TargetCache[Index].TargetId = TargetId;
+    }
+    TargetCache[Index].LastUsedTime = Now;
+
+    const FEAISTargetCacheEntry& Cached = TargetCache[Index];
+    const bool bFresh = Cached.bValid && (TTL > 0.0f ? Now - Cached.ResolveTime < TTL : Cached.ResolveFrame == GFrameCounter);
+    if (!bFresh)
+    {
+        // Every target this agent uses is refreshed in the same provider call
+        RefreshTargetCache(Pawn, Now);
+        Index = TargetCache.IndexOfByPredicate([TargetId](const FEAISTargetCacheEntry& Entry) { return Entry.TargetId == TargetId; });
+    }
+
+    const FEAISTargetCacheEntry& Entry = TargetCache[Index];
+    if (Entry.bResolved)
+    {
+        OutLocation = Entry.Location;
+    }
+    return Entry.bResolved;
+}
+
+void UAIComponent::RefreshTargetCache(APawn* Pawn, double Now)
+{
+    TargetCache.RemoveAll([Now](const FEAISTargetCacheEntry& Entry) { return Now - Entry.LastUsedTime > TargetCacheKeepSeconds; });
+
+    TArray<FName> TargetIds;
+    TargetIds.Reserve(TargetCache.Num());
+    for (const FEAISTargetCacheEntry& Entry : TargetCache)
+    {
+        TargetIds.Add(Entry.TargetId);
+    }
+
+    TArray<FVector> Locations;
+    TArray<bool> Resolved;
+    IEAIS_TargetProvider::Execute_EAIS_GetTargetLocations(Pawn, TargetIds, Locations, Resolved);
+
+    for (int32 Index = 0; Index < TargetCache.Num(); ++Index)
+    {
+        FEAISTargetCacheEntry& Entry = TargetCache[Index];
+        Entry.bResolved = Resolved.IsValidIndex(Index) && Resolved[Index] && Locations.IsValidIndex(Index);
+        Entry.Location = Entry.bResolved ? Locations[Index] : FVector::ZeroVector;
+        Entry.ResolveTime = Now;
+        Entry.ResolveFrame = GFrameCounter;
+        Entry.bValid = true;
+    }
+}
+
 APawn* UAIComponent::GetOwnerPawn() const
 {
     AActor* Owner = GetOwner();
@@ -314,15 +638,28 @@ AController* UAIComponent::GetOwnerController() const
     return nullptr;
 }
 
-void UAIComponent::HandleStateChanged(const FString& OldState, const FString& NewState)
+void UAIComponent::HandleStateChanged(const FEAISStateChange& Change)
 {
     if (bDebugMode)
     {
-        UE_LOG(LogTemp, Log, TEXT("UAIComponent [%s]: State Change %s -> %s"), 
-            *GetBehaviorName(), *OldState, *NewState);
+        UE_LOG(LogTemp, Log, TEXT("UAIComponent [%s]: State Change %s -> %s"),
+            *GetBehaviorName(), *Change.OldStateName.ToString(), *Change.NewStateName.ToString());
+    }
+
+    // Blueprint listeners are opt-in; only they need the ids as strings
+    if (OnStateChanged.IsBound())
+    {
+        const TArray<FAIState>& States = Interpreter.GetProgram()->Def.States;
+        OnStateChanged.Broadcast(Change.OldState != INDEX_NONE ? States[Change.OldState].Id : FString(), States[Change.NewState].Id);
     }
+}
 
-    OnStateChanged.Broadcast(OldState, NewState);
+void UAIComponent::HandleActionExecuted(const FAIActionEntry& Entry)
+{
+    if (OnActionExecuted.IsBound())
+    {
+        OnActionExecuted.Broadcast(Entry.Action, Entry.Params);
+    }
 }
 
 bool UAIComponent::ShouldRun() const
@@ -26,7 +26,7 @@ bool FAIInterpreter::LoadFromJson(const FString& JsonString, FString& OutError)
         return false;
     }
 
-    return LoadFromDef(TempBehavior->GetBehaviorDef());
+    return LoadFromProgram(TempBehavior->GetCompiledProgram());
 }
 
 bool FAIInterpreter::LoadFromDef(const FAIBehaviorDef& InBehaviorDef)
@@ -36,41 +36,27 @@ bool FAIInterpreter::LoadFromDef(const FAIBehaviorDef& InBehaviorDef)
         return false;
     }
 
-    BehaviorDef = InBehaviorDef;
+    return LoadFromProgram(FEAISCompiledProgram::Compile(InBehaviorDef));
+}
 
-    // Initialize blackboard with default values from behavior definition
-    for (const FEAISBlackboardEntry& Entry : BehaviorDef.Blackboard)
+bool FAIInterpreter::LoadFromProgram(const TSharedPtr<const FEAISCompiledProgram>& InProgram)
+{
+    if (!InProgram.IsValid() || !InProgram->Def.bIsValid)
     {
-        FBlackboardValue Value;
-        Value.Type = Entry.Value.Type;
-        Value.RawValue = Entry.Value.RawValue;
-        
-        // Parse from raw value based on type
-        switch (Entry.Value.Type)
-        {
-        case EBlackboardValueType::Bool:
-            Value.BoolValue = Entry.Value.RawValue.Equals(TEXT("true"), ESearchCase::IgnoreCase);
-            break;
-        case EBlackboardValueType::Int:
-            Value.IntValue = FCString::Atoi(*Entry.Value.RawValue);
-            break;
-        case EBlackboardValueType::Float:
-            Value.FloatValue = FCString::Atof(*Entry.Value.RawValue);
-            break;
-        case EBlackboardValueType::String:
-            Value.StringValue = Entry.Value.RawValue;
-            break;
-        case EBlackboardValueType::Vector:
-            Value.VectorValue.InitFromString(Entry.Value.RawValue);
-            break;
-        default:
-            Value.StringValue = Entry.Value.RawValue;
-            break;
-        }
-
-        Blackboard.Add(Entry.Key, Value);
+        return false;
     }
 
+    // Records and the state index point into the old program's states
+    AbortRunningActions();
+    CurrentStateIndex = INDEX_NONE;
+    PreviousStateIndex = INDEX_NONE;
+
+    Program = InProgram;
+
+    // Initialize blackboard from the program's prebaked defaults
+    ResetBlackboardLayout();
+    ApplySharedDefaults();
+
     return true;
 }
 
@@ -82,118 +68,176 @@ void FAIInterpreter::Initialize(UAIComponent* OwnerComp)
 
 void FAIInterpreter::Reset()
 {
-    CurrentStateId.Empty();
-    PreviousStateId.Empty();
+    AbortRunningActions();
+
+    CurrentStateIndex = INDEX_NONE;
+    PreviousStateIndex = INDEX_NONE;
     EventQueue.Empty();
-    RecentEvents.Empty();
-    TimerValues.Empty();
+    RecentEventIds.Reset();
     StateElapsedTime = 0.0f;
     TotalRuntime = 0.0f;
     bIsPaused = false;
 
     // Reinitialize blackboard
-    Blackboard.Empty();
-    for (const FEAISBlackboardEntry& Entry : BehaviorDef.Blackboard)
+    ResetBlackboardLayout();
+    if (!Program.IsValid())
     {
-        FBlackboardValue Value;
-        Value.Type = Entry.Value.Type;
-        Value.RawValue = Entry.Value.RawValue;
-        
-        if (Entry.Value.Type == EBlackboardValueType::Bool)
-        {
-            Value.BoolValue = Entry.Value.RawValue.Equals(TEXT("true"), ESearchCase::IgnoreCase);
-        }
-        else if (Entry.Value.Type == EBlackboardValueType::Int)
-        {
-            Value.IntValue = FCString::Atoi(*Entry.Value.RawValue);
-        }
-        else if (Entry.Value.Type == EBlackboardValueType::Float)
-        {
-            Value.FloatValue = FCString::Atof(*Entry.Value.RawValue);
-        }
-        else
-        {
-            Value.StringValue = Entry.Value.RawValue;
-        }
-        Blackboard.Add(Entry.Key, Value);
+        return;
     }
 
+    ApplySharedDefaults();
+
     // Enter initial state
-    if (!BehaviorDef.InitialState.IsEmpty())
+    if (Program->InitialState != INDEX_NONE)
     {
-        EnterState(BehaviorDef.InitialState);
+        EnterState(Program->InitialState);
     }
 }
 
+void FAIInterpreter::TakeProgramStorage(FAIInterpreter& Other)
+{
+    // Records point into the program's states
+    AbortRunningActions();
+    Other.AbortRunningActions();
+
+    Program = MoveTemp(Other.Program);
+    Blackboard = MoveTemp(Other.Blackboard);
+    BlackboardSet = MoveTemp(Other.BlackboardSet);
+    DynamicSlots = MoveTemp(Other.DynamicSlots);
+    ActionRecords = MoveTemp(Other.ActionRecords);
+    EventQueue = MoveTemp(Other.EventQueue);
+    EventQueue.Reset();
+    CurrentStateIndex = INDEX_NONE;
+
+    Other.Program.Reset();
+    Other.CurrentStateIndex = INDEX_NONE;
+    Other.RebindObservers();
+
+    RebindObservers();
+}
+
 void FAIInterpreter::Tick(float DeltaSeconds)
 {
-    if (bIsPaused && !bShouldStep)
+    if (!BeginTick(DeltaSeconds))
     {
         return;
     }
 
+    EndTick(SelectTransition());
+}
+
+bool FAIInterpreter::BeginTick(float DeltaSeconds)
+{
+    if (bIsPaused && !bShouldStep)
+    {
+        return false;
+    }
+
     bShouldStep = false;
 
     if (!IsValid())
     {
-        return;
+        return false;
     }
 
     // Update timers
     StateElapsedTime += DeltaSeconds;
     TotalRuntime += DeltaSeconds;
-    
-    for (auto& Pair : TimerValues)
-    {
-        Pair.Value += DeltaSeconds;
-    }
 
     // Process events
     ProcessEvents();
 
-    // Get current state
-    const FAIState* CurrentState = GetState(CurrentStateId);
-    if (!CurrentState)
-    {
-        return;
-    }
+    // Advance latent actions before OnTick so finished ones are visible to transitions
+    TickRunningActions(DeltaSeconds);
 
-    // Execute OnTick actions
-    ExecuteActions(CurrentState->OnTick);
+    // Execute OnTick actions (running ones are ticked above, not restarted)
+    ExecuteActions(Program->Def.States[CurrentStateIndex].OnTick, true);
+
+    return true;
+}
 
-    // Evaluate transitions (sorted by priority, deterministic tie-break by original order)
-    struct FIndexedTransition
+int32 FAIInterpreter::SelectTransition() const
+{
+    if (!IsValid())
     {
-        int32 Index = 0;
-        FAITransition Transition;
-    };
+        return INDEX_NONE;
+    }
 
-    TArray<FIndexedTransition> SortedTransitions;
-    SortedTransitions.Reserve(CurrentState->Transitions.Num());
-    for (int32 Index = 0; Index < CurrentState->Transitions.Num(); ++Index)
+    // Transitions are pre-sorted by priority; event-gated ones are only looked at when their event arrived
+    const FEAISCompiledState& State = Program->States[CurrentStateIndex];
+    int32 Selected = INDEX_NONE;
+    for (int32 Rank : State.NonEventRanks)
     {
-        FIndexedTransition Item;
-        Item.Index = Index;
-        Item.Transition = CurrentState->Transitions[Index];
-        SortedTransitions.Add(MoveTemp(Item));
+        if (EvaluateCompiledCondition(State.Transitions[Rank].Condition))
+        {
+            Selected = Rank;
+            break;
+        }
     }
 
-    SortedTransitions.Sort([](const FIndexedTransition& A, const FIndexedTransition& B)
+    return SelectEventTransition(Selected);
+}
+
+int32 FAIInterpreter::SelectEventTransition(int32 BoundRank) const
+{
+    const FEAISCompiledState& State = Program->States[CurrentStateIndex];
+    for (int32 EventId : RecentEventIds)
     {
-        if (A.Transition.Priority != B.Transition.Priority)
+        const TArray<int32>* Candidates = State.EventRanks.Find(EventId);
+        if (!Candidates)
         {
-            return A.Transition.Priority > B.Transition.Priority;
+            continue;
         }
-        return A.Index < B.Index;
-    });
 
-    for (const FIndexedTransition& Item : SortedTransitions)
+        // Candidates are ascending, so the first pass is this event's best; keep the best across events
+        for (int32 Rank : *Candidates)
+        {
+            if (BoundRank != INDEX_NONE && Rank >= BoundRank)
+            {
+                break;
+            }
+            if (EvaluateCompiledCondition(State.Transitions[Rank].Condition))
+            {
+                BoundRank = Rank;
+                break;
+            }
+        }
+    }
+
+    return BoundRank;
+}
+
+void FAIInterpreter::EndTick(int32 TransitionRank)
+{
+    if (ApplyTransition(TransitionRank))
     {
-        const FAITransition& Trans = Item.Transition;
-        if (EvaluateCondition(Trans.Condition))
+        // Run-to-completion: re-evaluate the new state's transitions (OnTick is not rerun).
+        // Recent events stay visible so an event can drive a whole chain.
+        TArray<int32, TInlineAllocator<8>> Visited;
+        Visited.Add(PreviousStateIndex);
+        Visited.Add(CurrentStateIndex);
+
+        for (int32 Count = 1; Count < Program->Def.MaxTransitionsPerTick; ++Count)
         {
-            ForceTransition(Trans.To);
-            break;
+            const int32 Rank = SelectTransition();
+            if (Rank == INDEX_NONE)
+            {
+                break;
+            }
+
+            const int32 Target = Program->States[CurrentStateIndex].Transitions[Rank].TargetState;
+            if (Visited.Contains(Target))
+            {
+                UE_LOG(LogTemp, Verbose, TEXT("FAIInterpreter: Transition chain stopped at '%s' (loop back to '%s')"),
+                    *Program->Def.States[CurrentStateIndex].Id, Target != INDEX_NONE ? *Program->Def.States[Target].Id : TEXT("?"));
+                break;
+            }
+
+            if (!ApplyTransition(Rank))
+            {
+                break;
+            }
+            Visited.Add(CurrentStateIndex);
         }
     }
 
@@ -201,6 +245,46 @@ void FAIInterpreter::Tick(float DeltaSeconds)
     ClearRecentEvents();
 }
 
+void FAIInterpreter::EndTick(int32 TransitionRank, const FEAISCompiledProgram* SelectedProgram, int32 SelectedState)
+{
+    // A rank only means something in the state it was selected in
+    if (Program.Get() != SelectedProgram || CurrentStateIndex != SelectedState)
+    {
+        TransitionRank = SelectTransition();
+    }
+    EndTick(TransitionRank);
+}
+
+bool FAIInterpreter::ApplyTransition(int32 TransitionRank)
+{
+    if (TransitionRank == INDEX_NONE || !IsValid())
+    {
+        return false;
+    }
+
+    const TArray<FEAISCompiledTransition>& Transitions = Program->States[CurrentStateIndex].Transitions;
+    if (!Transitions.IsValidIndex(TransitionRank))
+    {
+        return false;
+    }
+
+    const FEAISCompiledTransition& Trans = Transitions[TransitionRank];
+    if (Trans.TargetState == INDEX_NONE)
+    {
+        const FAIState& State = Program->Def.States[CurrentStateIndex];
+        UE_LOG(LogTemp, Warning, TEXT("FAIInterpreter: Cannot transition to unknown state '%s'"), *State.Transitions[Trans.SourceIndex].To);
+        return false;
+    }
+
+    if (Trans.TargetState == CurrentStateIndex)
+    {
+        return false;
+    }
+
+    TransitionTo(Trans.TargetState);
+    return true;
+}
+
 void FAIInterpreter::EnqueueEvent(const FString& EventName, const FAIEventPayload& Payload)
 {
     FAIQueuedEvent Event;
@@ -210,22 +294,38 @@ void FAIInterpreter::EnqueueEvent(const FString& EventName, const FAIEventPayloa
     EventQueue.Add(Event);
 }
 
+void FAIInterpreter::EnqueueEventId(int32 EventId)
+{
+    if (!Program.IsValid() || !Program->EventNames.IsValidIndex(EventId))
+    {
+        return;
+    }
+
+    FAIQueuedEvent& Event = EventQueue.AddDefaulted_GetRef();
+    Event.EventId = EventId;
+    Event.QueuedTime = TotalRuntime;
+}
+
 bool FAIInterpreter::ForceTransition(const FString& StateId)
 {
-    if (StateId.IsEmpty() || StateId == CurrentStateId)
+    if (StateId.IsEmpty())
     {
         return false;
     }
 
-    const FAIState* NewState = GetState(StateId);
-    if (!NewState)
+    const int32 StateIndex = Program.IsValid() ? Program->FindState(StateId) : INDEX_NONE;
+    if (StateIndex == INDEX_NONE)
     {
         UE_LOG(LogTemp, Warning, TEXT("FAIInterpreter: Cannot transition to unknown state '%s'"), *StateId);
         return false;
     }
 
-    ExitState();
-    EnterState(StateId);
+    if (StateIndex == CurrentStateIndex)
+    {
+        return false;
+    }
+
+    TransitionTo(StateIndex);
     return true;
 }
 
@@ -241,13 +341,44 @@ void FAIInterpreter::StepTick()
 
 void FAIInterpreter::SetBlackboardValue(const FString& Key, const FBlackboardValue& Value)
 {
-    Blackboard.Add(Key, Value);
+    int32 Slot = FindSlot(Key);
+
+    // "team."/"global." keys write through to the shared blackboard
+    FName SharedKey;
+    EEAISBlackboardScope Scope = EEAISBlackboardScope::Agent;
+    if (Slot == INDEX_NONE)
+    {
+        Scope = EAIS::ParseBlackboardScope(Key, SharedKey);
+    }
+    else if (Program.IsValid() && Slot < Program->NumSlots())
+    {
+        Scope = Program->GetSlotScope(Slot);
+        SharedKey = Program->GetSlotSharedKey(Slot);
+    }
+
+    if (Scope != EEAISBlackboardScope::Agent)
+    {
+        if (FEAISSharedBlackboard* Shared = GetSharedBlackboard(Scope))
+        {
+            Shared->Set(SharedKey, Value);
+            return;
+        }
+        // Unbound scope (standalone interpreter, or before BeginPlay binding): keep it as an agent key
+    }
+
+    if (Slot == INDEX_NONE)
+    {
+        Slot = FindOrAddSlot(Key);
+    }
+
+    Blackboard[Slot] = Value;
+    BlackboardSet[Slot] = true;
+    MarkSlotChanged(Slot);
 }
 
 bool FAIInterpreter::GetBlackboardValue(const FString& Key, FBlackboardValue& OutValue) const
 {
-    const FBlackboardValue* Found = Blackboard.Find(Key);
-    if (Found)
+    if (const FBlackboardValue* Found = FindValue(Key))
     {
         OutValue = *Found;
         return true;
@@ -262,12 +393,8 @@ void FAIInterpreter::SetBlackboardBool(const FString& Key, bool Value)
 
 bool FAIInterpreter::GetBlackboardBool(const FString& Key) const
 {
-    FBlackboardValue Value;
-    if (GetBlackboardValue(Key, Value))
-    {
-        return Value.BoolValue;
-    }
-    return false;
+    const FBlackboardValue* Value = FindValue(Key);
+    return Value ? Value->BoolValue : false;
 }
 
 void FAIInterpreter::SetBlackboardFloat(const FString& Key, float Value)
@@ -277,12 +404,8 @@ void FAIInterpreter::SetBlackboardFloat(const FString& Key, float Value)
 
 float FAIInterpreter::GetBlackboardFloat(const FString& Key) const
 {
-    FBlackboardValue Value;
-    if (GetBlackboardValue(Key, Value))
-    {
-        return Value.FloatValue;
-    }
-    return 0.0f;
+    const FBlackboardValue* Value = FindValue(Key);
+    return Value ? Value->FloatValue : 0.0f;
 }
 
 void FAIInterpreter::SetBlackboardVector(const FString& Key, const FVector& Value)
@@ -292,12 +415,8 @@ void FAIInterpreter::SetBlackboardVector(const FString& Key, const FVector& Valu
 
 FVector FAIInterpreter::GetBlackboardVector(const FString& Key) const
 {
-    FBlackboardValue Value;
-    if (GetBlackboardValue(Key, Value))
-    {
-        return Value.VectorValue;
-    }
-    return FVector::ZeroVector;
+    const FBlackboardValue* Value = FindValue(Key);
+    return Value ? Value->VectorValue : FVector::ZeroVector;
 }
 
 void FAIInterpreter::SetBlackboardObject(const FString& Key, UObject* Value)
@@ -307,153 +426,471 @@ void FAIInterpreter::SetBlackboardObject(const FString& Key, UObject* Value)
 
 UObject* FAIInterpreter::GetBlackboardObject(const FString& Key) const
 {
-    FBlackboardValue Value;
-    if (GetBlackboardValue(Key, Value) && Value.ObjectValue.IsValid())
-    {
-        return Value.ObjectValue.Get();
-    }
-    return nullptr;
+    const FBlackboardValue* Value = FindValue(Key);
+    return Value ? Value->GetObjectValue() : nullptr;
 }
 
-TArray<FString> FAIInterpreter::GetAllStateIds() const
+// ==================== Blackboard Key Handles ====================
+
+bool FAIInterpreter::ResolveKeyHandle(FEAISBlackboardKeyHandle& Handle) const
 {
-    TArray<FString> Result;
-    for (const FAIState& State : BehaviorDef.States)
+    Handle.Slot = INDEX_NONE;
+    Handle.ProgramSerial = 0;
+    if (!Program.IsValid())
     {
-        Result.Add(State.Id);
+        return false;
     }
-    return Result;
+
+    const int32 Slot = Program->FindSlot(Handle.Key);
+    if (Slot == INDEX_NONE)
+    {
+        return false;
+    }
+
+    // Keys without a default cannot be type-checked here
+    if (Program->DefaultImageSet[Slot] && Program->DefaultImage[Slot].Type != Handle.Type)
+    {
+        UE_LOG(LogTemp, Warning, TEXT("FAIInterpreter: Blackboard key '%s' of '%s' is %s, handle expects %s"), *Handle.Key, *Program->Def.Name,
+            *StaticEnum<EBlackboardValueType>()->GetNameStringByValue(static_cast<int64>(Program->DefaultImage[Slot].Type)),
+            *StaticEnum<EBlackboardValueType>()->GetNameStringByValue(static_cast<int64>(Handle.Type)));
+        return false;
+    }
+
+    Handle.Slot = Slot;
+    Handle.ProgramSerial = Program->Serial;
+    return true;
 }
 
-const FAIState* FAIInterpreter::GetState(const FString& StateId) const
+int32 FAIInterpreter::GetHandleSlot(const FEAISBlackboardKeyHandle& Handle) const
 {
-    for (const FAIState& State : BehaviorDef.States)
+    if (!Program.IsValid())
     {
-        if (State.Id == StateId)
-        {
-            return &State;
-        }
+        return INDEX_NONE;
     }
-    return nullptr;
+    return Handle.ProgramSerial == Program->Serial ? Handle.Slot : Program->FindSlot(Handle.Key);
 }
 
-void FAIInterpreter::EnterState(const FString& StateId)
+FBlackboardValue* FAIInterpreter::GetWritableValue(const FEAISBlackboardKeyHandle& Handle, EBlackboardValueType Type)
 {
-    FString OldState = CurrentStateId;
-    CurrentStateId = StateId;
-    StateElapsedTime = 0.0f;
-
-    // Reset timer for this state
-    TimerValues.Add(StateId, 0.0f);
-
-    UE_LOG(LogTemp, Verbose, TEXT("FAIInterpreter: Entering state '%s'"), *StateId);
+    const int32 Slot = GetHandleSlot(Handle);
+    if (Slot == INDEX_NONE)
+    {
+        return nullptr;
+    }
 
-    const FAIState* State = GetState(StateId);
-    if (State)
+    // A handle rejected on type still finds the slot by key; never retype a declared key
+    if (Program->DefaultImageSet[Slot] && Program->DefaultImage[Slot].Type != Type)
     {
-        ExecuteActions(State->OnEnter);
+        UE_LOG(LogTemp, Warning, TEXT("FAIInterpreter: Ignoring %s write to blackboard key '%s' of '%s' (declared %s)"),
+            *StaticEnum<EBlackboardValueType>()->GetNameStringByValue(static_cast<int64>(Type)), *Handle.Key, *Program->Def.Name,
+            *StaticEnum<EBlackboardValueType>()->GetNameStringByValue(static_cast<int64>(Program->DefaultImage[Slot].Type)));
+        return nullptr;
     }
 
-    // Broadcast state change
-    if (OnStateChanged.IsBound())
+    FBlackboardValue* Value = nullptr;
+    const EEAISBlackboardScope Scope = Program->GetSlotScope(Slot);
+    if (FEAISSharedBlackboard* Shared = Scope != EEAISBlackboardScope::Agent ? GetSharedBlackboard(Scope) : nullptr)
+    {
+        Value = &Shared->FindOrAdd(Program->GetSlotSharedKey(Slot));
+    }
+    else
     {
-        OnStateChanged.Broadcast(OldState, StateId);
+        // Agent keys, and shared keys while their scope is unbound
+        Value = &Blackboard[Slot];
+        BlackboardSet[Slot] = true;
+        MarkSlotChanged(Slot);
     }
+
+    // Typed fields are authoritative at runtime (ToString reads them); RawValue is only the authored form
+    Value->Type = Type;
+    Value->RawValue.Reset();
+    return Value;
 }
 
-void FAIInterpreter::ExitState()
+void FAIInterpreter::SetBlackboardBool(const FEAISBlackboardKeyHandle& Handle, bool Value)
 {
-    if (CurrentStateId.IsEmpty())
+    if (FBlackboardValue* Target = GetWritableValue(Handle, EBlackboardValueType::Bool))
     {
-        return;
+        Target->BoolValue = Value;
     }
+    else if (GetHandleSlot(Handle) == INDEX_NONE)
+    {
+        SetBlackboardBool(Handle.Key, Value);
+    }
+}
 
-    UE_LOG(LogTemp, Verbose, TEXT("FAIInterpreter: Exiting state '%s'"), *CurrentStateId);
-
-    const FAIState* State = GetState(CurrentStateId);
-    if (State)
+void FAIInterpreter::SetBlackboardInt(const FEAISBlackboardKeyHandle& Handle, int32 Value)
+{
+    if (FBlackboardValue* Target = GetWritableValue(Handle, EBlackboardValueType::Int))
     {
-        ExecuteActions(State->OnExit);
+        Target->IntValue = Value;
     }
+    else if (GetHandleSlot(Handle) == INDEX_NONE)
+    {
+        SetBlackboardValue(Handle.Key, FBlackboardValue(Value));
+    }
+}
 
-    PreviousStateId = CurrentStateId;
+void FAIInterpreter::SetBlackboardFloat(const FEAISBlackboardKeyHandle& Handle, float Value)
+{
+    if (FBlackboardValue* Target = GetWritableValue(Handle, EBlackboardValueType::Float))
+    {
+        Target->FloatValue = Value;
+    }
+    else if (GetHandleSlot(Handle) == INDEX_NONE)
+    {
+        SetBlackboardFloat(Handle.Key, Value);
+    }
 }
 
-void FAIInterpreter::ExecuteActions(const TArray<FAIActionEntry>& Actions)
+void FAIInterpreter::SetBlackboardVector(const FEAISBlackboardKeyHandle& Handle, const FVector& Value)
 {
-    if (!OwnerComponent.IsValid())
+    if (FBlackboardValue* Target = GetWritableValue(Handle, EBlackboardValueType::Vector))
     {
-        return;
+        Target->VectorValue = Value;
+    }
+    else if (GetHandleSlot(Handle) == INDEX_NONE)
+    {
+        SetBlackboardVector(Handle.Key, Value);
     }
+}
 
-    UWorld* World = OwnerComponent->GetWorld();
-    if (!World)
+void FAIInterpreter::SetBlackboardObject(const FEAISBlackboardKeyHandle& Handle, UObject* Value)
+{
+    if (FBlackboardValue* Target = GetWritableValue(Handle, EBlackboardValueType::Object))
     {
-        return;
+        Target->ObjectValue = Value;
+    }
+    else if (GetHandleSlot(Handle) == INDEX_NONE)
+    {
+        SetBlackboardObject(Handle.Key, Value);
     }
+}
 
-    UEAISSubsystem* Subsystem = World->GetGameInstance()->GetSubsystem<UEAISSubsystem>();
-    if (!Subsystem)
+bool FAIInterpreter::GetBlackboardBool(const FEAISBlackboardKeyHandle& Handle) const
+{
+    const int32 Slot = GetHandleSlot(Handle);
+    const FBlackboardValue* Value = GetSlotValue(Slot != INDEX_NONE ? Slot : FindSlot(Handle.Key));
+    return Value ? Value->BoolValue : false;
+}
+
+int32 FAIInterpreter::GetBlackboardInt(const FEAISBlackboardKeyHandle& Handle) const
+{
+    const int32 Slot = GetHandleSlot(Handle);
+    const FBlackboardValue* Value = GetSlotValue(Slot != INDEX_NONE ? Slot : FindSlot(Handle.Key));
+    return Value ? Value->IntValue : 0;
+}
+
+float FAIInterpreter::GetBlackboardFloat(const FEAISBlackboardKeyHandle& Handle) const
+{
+    const int32 Slot = GetHandleSlot(Handle);
+    const FBlackboardValue* Value = GetSlotValue(Slot != INDEX_NONE ? Slot : FindSlot(Handle.Key));
+    return Value ? Value->FloatValue : 0.0f;
+}
+
+FVector FAIInterpreter::GetBlackboardVector(const FEAISBlackboardKeyHandle& Handle) const
+{
+    const int32 Slot = GetHandleSlot(Handle);
+    const FBlackboardValue* Value = GetSlotValue(Slot != INDEX_NONE ? Slot : FindSlot(Handle.Key));
+    return Value ? Value->VectorValue : FVector::ZeroVector;
+}
+
+UObject* FAIInterpreter::GetBlackboardObject(const FEAISBlackboardKeyHandle& Handle) const
+{
+    const int32 Slot = GetHandleSlot(Handle);
+    const FBlackboardValue* Value = GetSlotValue(Slot != INDEX_NONE ? Slot : FindSlot(Handle.Key));
+    return Value ? Value->GetObjectValue() : nullptr;
+}
+
+bool FAIInterpreter::GetBlackboardLocation(int32 Slot, FVector& OutLocation) const
+{
+    const FBlackboardValue* Value = GetSlotValue(Slot);
+    if (!Value)
     {
-        return;
+        return false;
     }
 
-    for (const FAIActionEntry& Entry : Actions)
+    if (Value->Type == EBlackboardValueType::Vector)
     {
-        UAIAction* Action = Subsystem->GetAction(Entry.Action);
-        if (Action)
-        {
-            Action->Execute(OwnerComponent.Get(), Entry.Params);
+        OutLocation = Value->VectorValue;
+        return true;
+    }
 
-            if (OnActionExecuted.IsBound())
-            {
-                OnActionExecuted.Broadcast(Entry.Action, Entry.Params);
-            }
-        }
-        else
+    if (Value->Type == EBlackboardValueType::Object)
+    {
+        if (const AActor* TargetActor = Cast<AActor>(Value->GetObjectValue()))
         {
-            UE_LOG(LogTemp, Warning, TEXT("FAIInterpreter: Unknown action '%s'"), *Entry.Action);
+            OutLocation = TargetActor->GetActorLocation();
+            return true;
         }
     }
+
+    return false;
 }
 
-bool FAIInterpreter::EvaluateCondition(const FAICondition& Condition) const
+bool FAIInterpreter::GetBlackboardLocation(const FString& Key, FVector& OutLocation) const
 {
-    switch (Condition.Type)
+    return GetBlackboardLocation(FindSlot(Key), OutLocation);
+}
+
+TArray<FString> FAIInterpreter::GetAllStateIds() const
+{
+    TArray<FString> Result;
+    if (Program.IsValid())
     {
-    case EAIConditionType::Blackboard:
+        for (const FAIState& State : Program->Def.States)
         {
-            FBlackboardValue CurrentValue;
-            if (!GetBlackboardValue(Condition.Name, CurrentValue))
-            {
-                // Key doesn't exist - check if the condition name itself is a key
-                // This handles simple conditions like "HasBall" which means "HasBall == true"
-                if (!GetBlackboardValue(Condition.Name, CurrentValue))
-                {
-                    return false;
-                }
-            }
-
-            // Parse the comparison value
-            FBlackboardValue CompareValue = CurrentValue;  // Same type
-            CompareValue.FromString(Condition.Value);
+            Result.Add(State.Id);
+        }
+    }
+    return Result;
+}
 
-            return CurrentValue.Compare(CompareValue, Condition.Operator);
+const FAIState* FAIInterpreter::GetState(const FString& StateId) const
+{
+    const int32 StateIndex = Program.IsValid() ? Program->FindState(StateId) : INDEX_NONE;
+    return StateIndex != INDEX_NONE ? &Program->Def.States[StateIndex] : nullptr;
+}
+
+void FAIInterpreter::EnterState(int32 StateIndex)
+{
+    const FAIState& State = Program->Def.States[StateIndex];
+
+    const int32 OldStateIndex = CurrentStateIndex;
+    CurrentStateIndex = StateIndex;
+    StateElapsedTime = 0.0f;
+    ActionRecords.Reset();
+
+    UE_LOG(LogTemp, Verbose, TEXT("FAIInterpreter: Entering state '%s'"), *State.Id);
+
+    ExecuteActions(State.OnEnter, true);
+
+    // Broadcast state change
+    if (OnStateChanged.IsBound())
+    {
+        FEAISStateChange Change;
+        Change.OldState = OldStateIndex;
+        Change.OldStateName = OldStateIndex != INDEX_NONE ? Program->StateNames[OldStateIndex] : NAME_None;
+        Change.NewState = StateIndex;
+        Change.NewStateName = Program->StateNames[StateIndex];
+        OnStateChanged.Broadcast(Change);
+    }
+}
+
+void FAIInterpreter::TransitionTo(int32 StateIndex)
+{
+    ExitState();
+    EnterState(StateIndex);
+}
+
+void FAIInterpreter::ExitState()
+{
+    if (CurrentStateIndex == INDEX_NONE)
+    {
+        return;
+    }
+
+    UE_LOG(LogTemp, Verbose, TEXT("FAIInterpreter: Exiting state '%s'"), *Program->Def.States[CurrentStateIndex].Id);
+
+    AbortRunningActions();
+
+    // OnExit actions are fire-and-forget; there is no state left to tick them in
+    ExecuteActions(Program->Def.States[CurrentStateIndex].OnExit, false);
+
+    PreviousStateIndex = CurrentStateIndex;
+}
+
+void FAIInterpreter::ExecuteActions(const TArray<FAIActionEntry>& Actions, bool bTrackStatus)
+{
+    if (!OwnerComponent.IsValid())
+    {
+        return;
+    }
+
+    UWorld* World = OwnerComponent->GetWorld();
+    if (!World)
+    {
+        return;
+    }
+
+    UEAISSubsystem* Subsystem = World->GetGameInstance()->GetSubsystem<UEAISSubsystem>();
+    if (!Subsystem)
+    {
+        return;
+    }
+
+    for (const FAIActionEntry& Entry : Actions)
+    {
+        FEAISActionRecord* Record = bTrackStatus ? ActionRecords.FindByPredicate([&Entry](const FEAISActionRecord& Item) { return Item.Entry == &Entry; }) : nullptr;
+        if (Record && (Record->Status == EAIActionStatus::Running || Record->bJustFinished))
+        {
+            Record->bJustFinished = false;
+            continue;
         }
 
-    case EAIConditionType::Event:
-        return RecentEvents.Contains(Condition.Name);
+        UAIAction* Action = Subsystem->GetAction(Entry.Action);
+        if (Action)
+        {
+            const int32 StateIndex = CurrentStateIndex;
+            const EAIActionStatus Status = Action->Execute(OwnerComponent.Get(), Entry.Params);
 
-    case EAIConditionType::Timer:
+            // Execute may have forced a transition; the entry then no longer belongs to the current state
+            if (bTrackStatus && StateIndex == CurrentStateIndex)
+            {
+                Record = ActionRecords.FindByPredicate([&Entry](const FEAISActionRecord& Item) { return Item.Entry == &Entry; });
+                if (!Record)
+                {
+                    Record = &ActionRecords.AddDefaulted_GetRef();
+                    Record->Entry = &Entry;
+                    Record->Action = Action;
+                }
+                Record->Status = Status;
+            }
+            else if (bTrackStatus && Status == EAIActionStatus::Running)
+            {
+                // The state changed under it: no record will tick or abort it in the new state
+                Action->Abort(OwnerComponent.Get());
+            }
+
+            if (OnActionExecuted.IsBound())
+            {
+                OnActionExecuted.Broadcast(Entry);
+            }
+        }
+        else
+        {
+            UE_LOG(LogTemp, Warning, TEXT("FAIInterpreter: Unknown action '%s'"), *Entry.Action);
+        }
+    }
+}
+
+void FAIInterpreter::TickRunningActions(float DeltaSeconds)
+{
+    // Index loop: an action may finish itself (or another record) while ticking
+    for (int32 Index = 0; Index < ActionRecords.Num(); ++Index)
+    {
+        if (ActionRecords[Index].Status != EAIActionStatus::Running)
+        {
+            continue;
+        }
+
+        const FAIActionEntry* Entry = ActionRecords[Index].Entry;
+        UAIAction* Action = ActionRecords[Index].Action.Get();
+        const EAIActionStatus Status = Action && OwnerComponent.IsValid()
+            ? Action->TickAction(OwnerComponent.Get(), Entry->Params, DeltaSeconds)
+            : EAIActionStatus::Failed;
+
+        // Skip the write if ticking the action changed state
+        if (ActionRecords.IsValidIndex(Index) && ActionRecords[Index].Entry == Entry && ActionRecords[Index].Status == EAIActionStatus::Running)
+        {
+            ActionRecords[Index].Status = Status;
+            ActionRecords[Index].bJustFinished = Status != EAIActionStatus::Running;
+        }
+    }
+}
+
+bool FAIInterpreter::FinishRunningAction(const UAIAction* Action, const FAIActionParams& Params, EAIActionStatus Status)
+{
+    // The entry's own params first; Blueprint passes a copy, matched by content
+    FEAISActionRecord* Match = ActionRecords.FindByPredicate([Action, &Params](const FEAISActionRecord& Record)
+    {
+        return Record.Status == EAIActionStatus::Running && Record.Action.Get() == Action && &Record.Entry->Params == &Params;
+    });
+    if (!Match)
+    {
+        Match = ActionRecords.FindByPredicate([Action, &Params](const FEAISActionRecord& Record)
         {
-            const float* Timer = TimerValues.Find(CurrentStateId);
-            if (Timer)
+            const FAIActionParams& EntryParams = Record.Entry->Params;
+            return Record.Status == EAIActionStatus::Running && Record.Action.Get() == Action
+                && EntryParams.Target == Params.Target && EntryParams.ExtraParams.OrderIndependentCompareEqual(Params.ExtraParams);
+        });
+    }
+
+    if (!Match)
+    {
+        return false;
+    }
+
+    Match->Status = Status;
+    Match->bJustFinished = Status != EAIActionStatus::Running;
+    return true;
+}
+
+void FAIInterpreter::AbortRunningActions()
+{
+    // Move out first so Abort callbacks cannot touch the list being iterated
+    TArray<FEAISActionRecord> Records = MoveTemp(ActionRecords);
+    ActionRecords.Reset();
+
+    for (const FEAISActionRecord& Record : Records)
+    {
+        if (Record.Status != EAIActionStatus::Running)
+        {
+            continue;
+        }
+
+        if (UAIAction* Action = Record.Action.Get())
+        {
+            Action->Abort(OwnerComponent.Get());
+        }
+    }
+}
+
+int32 FAIInterpreter::GetNumRunningActions() const
+{
+    int32 NumRunning = 0;
+    for (const FEAISActionRecord& Record : ActionRecords)
+    {
+        NumRunning += Record.Status == EAIActionStatus::Running ? 1 : 0;
+    }
+    return NumRunning;
+}
+
+bool FAIInterpreter::HasActionStatus(const FString& ActionName, uint8 StatusMask) const
+{
+    for (const FEAISActionRecord& Record : ActionRecords)
+    {
+        if ((StatusMask & EAIS::ActionStatusBit(Record.Status)) && Record.Entry->Action == ActionName)
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+bool FAIInterpreter::EvaluateCondition(const FAICondition& Condition) const
+{
+    switch (Condition.Type)
+    {
+    case EAIConditionType::Blackboard:
+        {
+            FBlackboardValue CurrentValue;
+            if (!GetBlackboardValue(Condition.Name, CurrentValue))
             {
-                return *Timer >= Condition.Seconds;
+                // Key doesn't exist - check if the condition name itself is a key
+                // This handles simple conditions like "HasBall" which means "HasBall == true"
+                if (!GetBlackboardValue(Condition.Name, CurrentValue))
+                {
+                    return false;
+                }
             }
-            return StateElapsedTime >= Condition.Seconds;
+
+            // Parse the comparison value
+            FBlackboardValue CompareValue = CurrentValue;  // Same type
+            CompareValue.FromString(Condition.Value);
+
+            return CurrentValue.Compare(CompareValue, Condition.Operator);
         }
 
+    case EAIConditionType::Event:
+    {
+        const int32 EventId = Program.IsValid() ? Program->FindEvent(Condition.Name) : INDEX_NONE;
+        return EventId != INDEX_NONE && RecentEventIds.Contains(EventId);
+    }
+
+    case EAIConditionType::Timer:
+        return StateElapsedTime >= Condition.Seconds;
+
     case EAIConditionType::Distance:
     {
         FVector TargetLocation = FVector::ZeroVector;
@@ -482,21 +919,12 @@ bool FAIInterpreter::EvaluateCondition(const FAICondition& Condition) const
             // Specialized/Temporary fallback for ball if not in BB
         }
 
-        AActor* Owner = OwnerComponent->GetOwner();
-        if (Owner)
+        FVector OwnerLocation;
+        if (GetOwnerLocation(OwnerLocation))
         {
-            float Distance = FVector::Dist(Owner->GetActorLocation(), TargetLocation);
+            float Distance = FVector::Dist(OwnerLocation, TargetLocation);
             float CompareDistance = FCString::Atof(*Condition.Value);
-
-            switch (Condition.Operator)
-            {
-            case EAIConditionOperator::Equal: return FMath::IsNearlyEqual(Distance, CompareDistance, 10.0f);
-            case EAIConditionOperator::NotEqual: return !FMath::IsNearlyEqual(Distance, CompareDistance, 10.0f);
-            case EAIConditionOperator::GreaterThan: return Distance > CompareDistance;
-            case EAIConditionOperator::LessThan: return Distance < CompareDistance;
-            case EAIConditionOperator::GreaterOrEqual: return Distance >= CompareDistance;
-            case EAIConditionOperator::LessOrEqual: return Distance <= CompareDistance;
-            }
+            return EAIS::CompareScalar(Distance, CompareDistance, Condition.Operator, EAIS::DistanceEqualTolerance);
         }
         return false;
     }
@@ -528,6 +956,12 @@ bool FAIInterpreter::EvaluateCondition(const FAICondition& Condition) const
         return false;
     }
 
+    case EAIConditionType::Action:
+    {
+        const bool bMatched = HasActionStatus(Condition.Name, EAIS::ParseActionStatusMask(Condition.Value));
+        return Condition.Operator == EAIConditionOperator::NotEqual ? !bMatched : bMatched;
+    }
+
     case EAIConditionType::Custom:
         // Registered C++ conditions would go here
         return false;
@@ -539,10 +973,17 @@ bool FAIInterpreter::EvaluateCondition(const FAICondition& Condition) const
 
 void FAIInterpreter::ProcessEvents()
 {
-    // Move events to recent events set for condition checking
-    for (const FAIQueuedEvent& Event : EventQueue)
+    // Move events to recent events set for condition checking.
+    // Events queued by OnEventReceived listeners are left for the next tick.
+    const int32 NumEvents = EventQueue.Num();
+    for (int32 Index = 0; Index < NumEvents && Index < EventQueue.Num(); ++Index)
     {
-        RecentEvents.Add(Event.EventName);
+        const FAIQueuedEvent& Event = EventQueue[Index];
+        const int32 EventId = Event.EventId != INDEX_NONE ? Event.EventId : Program->FindEvent(Event.EventName);
+        if (EventId != INDEX_NONE)
+        {
+            RecentEventIds.AddUnique(EventId);
+        }
         
         // Also set blackboard values from event payload
         for (const auto& Pair : Event.Payload.StringParams)
@@ -557,12 +998,570 @@ void FAIInterpreter::ProcessEvents()
         {
             SetBlackboardValue(Pair.Key, FBlackboardValue(Pair.Value));
         }
+
+        if (OnEventReceived.IsBound())
+        {
+            // A listener may enqueue and reallocate the queue
+            const FAIQueuedEvent Received = Event;
+            OnEventReceived.Broadcast(Received.EventId != INDEX_NONE ? Program->EventNames[Received.EventId] : Received.EventName, Received.Payload);
+        }
     }
 
-    EventQueue.Empty();
+    EventQueue.RemoveAt(0, FMath::Min(NumEvents, EventQueue.Num()));
 }
 
 void FAIInterpreter::ClearRecentEvents()
 {
-    RecentEvents.Empty();
+    RecentEventIds.Reset();
+}
+
+void FAIInterpreter::ResetBlackboardLayout()
+{
+    // Defaults were parsed once at compile time; copy them with the layout
+    if (Program.IsValid())
+    {
+        Blackboard = Program->DefaultImage;
+        BlackboardSet = Program->DefaultImageSet;
+    }
+    else
+    {
+        Blackboard.Reset();
+        BlackboardSet.Empty();
+    }
+    DynamicSlots.Reset();
+    RebindObservers();
+}
+
+int32 FAIInterpreter::FindSlot(const FString& Key) const
+{
+    if (Program.IsValid())
+    {
+        const int32 Slot = Program->FindSlot(Key);
+        if (Slot != INDEX_NONE)
+        {
+            return Slot;
+        }
+    }
+
+    const int32* Dynamic = DynamicSlots.Find(Key);
+    return Dynamic ? *Dynamic : INDEX_NONE;
+}
+
+int32 FAIInterpreter::FindOrAddSlot(const FString& Key)
+{
+    int32 Slot = FindSlot(Key);
+    if (Slot == INDEX_NONE)
+    {
+        Slot = Blackboard.AddDefaulted();
+        BlackboardSet.Add(false);
+        DynamicSlots.Add(Key, Slot);
+    }
+    return Slot;
+}
+
+const FBlackboardValue* FAIInterpreter::GetSlotValue(int32 Slot) const
+{
+    if (Slot == INDEX_NONE)
+    {
+        return nullptr;
+    }
+
+    // Team/global slots are read in place from the subsystem's shared blackboards
+    if (Program.IsValid() && Program->HasSharedSlots() && Slot < Program->NumSlots())
+    {
+        // Unbound scopes fall back to agent storage
+        const EEAISBlackboardScope Scope = Program->GetSlotScope(Slot);
+        if (const FEAISSharedBlackboard* Shared = Scope != EEAISBlackboardScope::Agent ? GetSharedBlackboard(Scope) : nullptr)
+        {
+            return Shared->Find(Program->GetSlotSharedKey(Slot));
+        }
+    }
+
+    return BlackboardSet[Slot] ? &Blackboard[Slot] : nullptr;
+}
+
+FEAISSharedBlackboard* FAIInterpreter::GetSharedBlackboard(EEAISBlackboardScope Scope) const
+{
+    switch (Scope)
+    {
+    case EEAISBlackboardScope::Team:   return TeamBlackboard.Get();
+    case EEAISBlackboardScope::Global: return GlobalBlackboard.Get();
+    default:                           return nullptr;
+    }
+}
+
+void FAIInterpreter::BindSharedBlackboards(const TSharedPtr<FEAISSharedBlackboard>& InTeam, const TSharedPtr<FEAISSharedBlackboard>& InGlobal)
+{
+    TeamBlackboard = InTeam;
+    GlobalBlackboard = InGlobal;
+    ApplySharedDefaults();
+}
+
+void FAIInterpreter::ApplySharedDefaults()
+{
+    if (!Program.IsValid())
+    {
+        return;
+    }
+
+    // Shared defaults are written once by the first agent, never over live values
+    for (const FEAISSharedDefault& Default : Program->SharedDefaults)
+    {
+        FEAISSharedBlackboard* Shared = GetSharedBlackboard(Default.Scope);
+        if (Shared && !Shared->Find(Default.Key))
+        {
+            Shared->Set(Default.Key, Default.Value);
+        }
+    }
+}
+
+// ==================== Blackboard Observers ====================
+
+FDelegateHandle FAIInterpreter::ObserveBlackboardKey(const FString& Key, FOnEAISBlackboardChanged::FDelegate&& Delegate)
+{
+    FEAISBlackboardObserver* Observer = Observers.FindByPredicate([&Key](const FEAISBlackboardObserver& Item) { return Item.Key == Key; });
+    if (!Observer)
+    {
+        Observer = &Observers.AddDefaulted_GetRef();
+        Observer->Key = Key;
+        RebindObservers();
+
+        // Start from the current value so only later changes are reported
+        const FBlackboardValue* Current = FindObservedValue(*Observer);
+        Observer->bHadValue = Current != nullptr;
+        Observer->LastValue = Current ? *Current : FBlackboardValue();
+        Observer->bDirty = false;
+    }
+    return Observer->Delegate.Add(MoveTemp(Delegate));
+}
+
+void FAIInterpreter::RemoveBlackboardObserver(const FString& Key, FDelegateHandle Handle)
+{
+    const int32 Index = Observers.IndexOfByPredicate([&Key](const FEAISBlackboardObserver& Item) { return Item.Key == Key; });
+    if (Index != INDEX_NONE)
+    {
+        Observers[Index].Delegate.Remove(Handle);
+        if (!Observers[Index].Delegate.IsBound())
+        {
+            Observers.RemoveAt(Index);
+            RebindObservers();
+        }
+    }
+}
+
+void FAIInterpreter::RemoveBlackboardObservers(const void* UserObject, const FString& Key)
+{
+    const int32 NumRemoved = Observers.RemoveAll([UserObject, &Key](FEAISBlackboardObserver& Item)
+    {
+        if (!Key.IsEmpty() && Item.Key != Key)
+        {
+            return false;
+        }
+        Item.Delegate.RemoveAll(UserObject);
+        return !Item.Delegate.IsBound();
+    });
+    if (NumRemoved > 0)
+    {
+        RebindObservers();
+    }
+}
+
+void FAIInterpreter::DispatchBlackboardChanges()
+{
+    for (int32 Index = 0; Index < Observers.Num(); ++Index)
+    {
+        FEAISBlackboardObserver& Observer = Observers[Index];
+
+        // Shared keys are written by other agents and game code, so they are always compared
+        if (!Observer.bDirty && Observer.Slot != INDEX_NONE)
+        {
+            continue;
+        }
+        Observer.bDirty = false;
+
+        const FBlackboardValue* Current = FindObservedValue(Observer);
+        const bool bHasValue = Current != nullptr;
+        if (bHasValue == Observer.bHadValue && (!bHasValue || Current->Identical(Observer.LastValue)))
+        {
+            continue;
+        }
+
+        Observer.bHadValue = bHasValue;
+        Observer.LastValue = bHasValue ? *Current : FBlackboardValue();
+
+        // Observers may add or remove observers, so broadcast from copies
+        const FOnEAISBlackboardChanged Delegate = Observer.Delegate;
+        const FString Key = Observer.Key;
+        const FBlackboardValue Value = Observer.LastValue;
+        Delegate.Broadcast(Key, Value);
+    }
+}
+
+void FAIInterpreter::RebindObservers()
+{
+    for (FEAISBlackboardObserver& Observer : Observers)
+    {
+        // Agent keys the program does not declare get an unset dynamic slot so writes can flag them
+        FName SharedKey;
+        const bool bShared = EAIS::ParseBlackboardScope(Observer.Key, SharedKey) != EEAISBlackboardScope::Agent;
+        Observer.Slot = bShared ? INDEX_NONE : FindOrAddSlot(Observer.Key);
+        Observer.bDirty = true;
+    }
+
+    ObserverBySlot.Init(INDEX_NONE, Observers.Num() > 0 ? Blackboard.Num() : 0);
+    for (int32 Index = 0; Index < Observers.Num(); ++Index)
+    {
+        if (Observers[Index].Slot != INDEX_NONE)
+        {
+            ObserverBySlot[Observers[Index].Slot] = Index;
+        }
+    }
+}
+
+const FBlackboardValue* FAIInterpreter::FindObservedValue(const FEAISBlackboardObserver& Observer) const
+{
+    if (Observer.Slot != INDEX_NONE)
+    {
+        return GetSlotValue(Observer.Slot);
+    }
+
+    return FindValue(Observer.Key);
+}
+
+const FBlackboardValue* FAIInterpreter::FindValue(const FString& Key) const
+{
+    // Program slots resolve their own scope
+    const int32 Slot = FindSlot(Key);
+    if (Slot != INDEX_NONE && Program.IsValid() && Slot < Program->NumSlots())
+    {
+        return GetSlotValue(Slot);
+    }
+
+    // Shared keys the program does not reference; agent storage if their scope is unbound
+    FName SharedKey;
+    if (const FEAISSharedBlackboard* Shared = GetSharedBlackboard(EAIS::ParseBlackboardScope(Key, SharedKey)))
+    {
+        return Shared->Find(SharedKey);
+    }
+    return GetSlotValue(Slot);
+}
+
+FVector FAIInterpreter::GetSlotLocation(int32 Slot) const
+{
+    FVector Location = FVector::ZeroVector;
+    GetBlackboardLocation(Slot, Location);
+    return Location;
+}
+
+bool FAIInterpreter::GetOwnerLocation(FVector& OutLocation) const
+{
+    const AActor* Owner = OwnerComponent.IsValid() ? OwnerComponent->GetOwner() : nullptr;
+    if (!Owner)
+    {
+        return false;
+    }
+
+    OutLocation = Owner->GetActorLocation();
+    return true;
+}
+
+bool FAIInterpreter::EvaluateCompiledCondition(int32 ConditionIndex) const
+{
+    const FEAISCompiledCondition& Condition = Program->Conditions[ConditionIndex];
+
+    switch (Condition.Type)
+    {
+    case EAIConditionType::Blackboard:
+    {
+        const FBlackboardValue* CurrentValue = GetSlotValue(Condition.Slot);
+        if (!CurrentValue)
+        {
+            return false;
+        }
+
+        if (CurrentValue->Type == EBlackboardValueType::Object)
+        {
+            // Objects cannot be parsed from a compare string; matches EvaluateCondition
+            return CurrentValue->Compare(*CurrentValue, Condition.Operator);
+        }
+
+        return CurrentValue->Compare(Condition.CompareValue, Condition.Operator);
+    }
+
+    case EAIConditionType::Event:
+        return RecentEventIds.Contains(Condition.EventId);
+
+    case EAIConditionType::Timer:
+        return StateElapsedTime >= Condition.Seconds;
+
+    case EAIConditionType::Distance:
+    {
+        FVector OwnerLocation;
+        if (!GetOwnerLocation(OwnerLocation))
+        {
+            return false;
+        }
+
+        const float Distance = FVector::Dist(OwnerLocation, GetSlotLocation(Condition.Slot));
+        return EAIS::CompareScalar(Distance, Condition.CompareDistance, Condition.Operator, EAIS::DistanceEqualTolerance);
+    }
+
+    case EAIConditionType::And:
+    {
+        for (int32 Child : Condition.Children)
+        {
+            if (!EvaluateCompiledCondition(Child)) return false;
+        }
+        return Condition.Children.Num() > 0;
+    }
+
+    case EAIConditionType::Or:
+    {
+        for (int32 Child : Condition.Children)
+        {
+            if (EvaluateCompiledCondition(Child)) return true;
+        }
+        return false;
+    }
+
+    case EAIConditionType::Not:
+        return Condition.Children.Num() > 0 && !EvaluateCompiledCondition(Condition.Children[0]);
+
+    case EAIConditionType::Action:
+    {
+        const bool bMatched = HasActionStatus(Condition.Name, Condition.StatusMask);
+        return Condition.Operator == EAIConditionOperator::NotEqual ? !bMatched : bMatched;
+    }
+
+    case EAIConditionType::Custom:
+    default:
+        return false;
+    }
+}
+
+// ==================== Batched Transition Selection ====================
+
+namespace
+{
+    /** Column-wise compare. The operator switch is hoisted out of the loops so each loop is a straight vectorizable kernel. */
+    void CompareColumns(const float* RESTRICT Lhs, const float* RESTRICT Rhs, EAIConditionOperator Op, float Tolerance, uint8* RESTRICT OutMask, int32 Num)
+    {
+        switch (Op)
+        {
+        case EAIConditionOperator::Equal:
+            for (int32 i = 0; i < Num; ++i) { OutMask[i] = FMath::Abs(Lhs[i] - Rhs[i]) <= Tolerance; }
+            break;
+        case EAIConditionOperator::NotEqual:
+            for (int32 i = 0; i < Num; ++i) { OutMask[i] = FMath::Abs(Lhs[i] - Rhs[i]) > Tolerance; }
+            break;
+        case EAIConditionOperator::GreaterThan:
+            for (int32 i = 0; i < Num; ++i) { OutMask[i] = Lhs[i] > Rhs[i]; }
+            break;
+        case EAIConditionOperator::LessThan:
+            for (int32 i = 0; i < Num; ++i) { OutMask[i] = Lhs[i] < Rhs[i]; }
+            break;
+        case EAIConditionOperator::GreaterOrEqual:
+            for (int32 i = 0; i < Num; ++i) { OutMask[i] = Lhs[i] >= Rhs[i]; }
+            break;
+        case EAIConditionOperator::LessOrEqual:
+            for (int32 i = 0; i < Num; ++i) { OutMask[i] = Lhs[i] <= Rhs[i]; }
+            break;
+        default:
+            FMemory::Memzero(OutMask, Num);
+            break;
+        }
+    }
+
+    /** Distances from SoA position columns */
+    void DistanceColumns(const double* RESTRICT AX, const double* RESTRICT AY, const double* RESTRICT AZ,
+                         const double* RESTRICT BX, const double* RESTRICT BY, const double* RESTRICT BZ,
+                         float* RESTRICT OutDistance, int32 Num)
+    {
+        for (int32 i = 0; i < Num; ++i)
+        {
+            const double DX = AX[i] - BX[i];
+            const double DY = AY[i] - BY[i];
+            const double DZ = AZ[i] - BZ[i];
+            OutDistance[i] = static_cast<float>(FMath::Sqrt(DX * DX + DY * DY + DZ * DZ));
+        }
+    }
+}
+
+void FEAISTransitionBatchScratch::SetNum(int32 Num)
+{
+    Lhs.SetNumUninitialized(Num, false);
+    Rhs.SetNumUninitialized(Num, false);
+    Mask.SetNumUninitialized(Num, false);
+    Scalar.SetNumUninitialized(Num, false);
+    for (TArray<double>* Column : { &AX, &AY, &AZ, &BX, &BY, &BZ })
+    {
+        Column->SetNumUninitialized(Num, false);
+    }
+}
+
+void FAIInterpreter::SelectTransitionsBatch(TArrayView<FAIInterpreter* const> Batch, TArrayView<int32> OutTransitionRanks, FEAISTransitionBatchScratch& Scratch)
+{
+    check(Batch.Num() == OutTransitionRanks.Num());
+
+    for (int32& Rank : OutTransitionRanks)
+    {
+        Rank = INDEX_NONE;
+    }
+
+    if (Batch.Num() == 0 || !Batch[0]->IsValid())
+    {
+        return;
+    }
+
+    const FEAISCompiledProgram& SharedProgram = *Batch[0]->Program;
+    const int32 StateIndex = Batch[0]->CurrentStateIndex;
+    const FEAISCompiledState& State = SharedProgram.States[StateIndex];
+    const TArray<FEAISCompiledTransition>& Transitions = State.Transitions;
+
+    // Agents still waiting for a passing transition (indices into Batch)
+    TArray<int32, TInlineAllocator<32>> Pending;
+    Pending.Reserve(Batch.Num());
+    for (int32 Index = 0; Index < Batch.Num(); ++Index)
+    {
+        checkSlow(Batch[Index]->Program.Get() == &SharedProgram && Batch[Index]->CurrentStateIndex == StateIndex);
+        Pending.Add(Index);
+    }
+
+    // Non-event transitions column-wise; event-gated transitions are merged per agent below
+    for (int32 RankIndex = 0; RankIndex < State.NonEventRanks.Num() && Pending.Num() > 0; ++RankIndex)
+    {
+        const int32 Rank = State.NonEventRanks[RankIndex];
+        const FEAISCompiledCondition& Condition = SharedProgram.Conditions[Transitions[Rank].Condition];
+        const int32 Num = Pending.Num();
+        Scratch.SetNum(Num);
+
+        float* Lhs = Scratch.Lhs.GetData();
+        float* Rhs = Scratch.Rhs.GetData();
+        uint8* Mask = Scratch.Mask.GetData();
+        uint8* Scalar = Scratch.Scalar.GetData();
+        float Tolerance = UE_SMALL_NUMBER;
+        EAIConditionOperator Op = Condition.Operator;
+        bool bVectorized = true;
+
+        // Gather: fill SoA columns for lanes that can take the vector path, flag the rest for scalar evaluation
+        switch (Condition.Type)
+        {
+        case EAIConditionType::Blackboard:
+            for (int32 Lane = 0; Lane < Num; ++Lane)
+            {
+                const FBlackboardValue* Value = Batch[Pending[Lane]]->GetSlotValue(Condition.Slot);
+                Scalar[Lane] = 0;
+                Lhs[Lane] = 0.0f;
+                Rhs[Lane] = 0.0f;
+                if (!Value)
+                {
+                    // Missing key never passes
+                    Scalar[Lane] = 2;
+                    continue;
+                }
+
+                switch (Value->Type)
+                {
+                case EBlackboardValueType::Float:
+                    Lhs[Lane] = Value->FloatValue;
+                    Rhs[Lane] = Condition.CompareValue.FloatValue;
+                    break;
+                case EBlackboardValueType::Int:
+                    Lhs[Lane] = static_cast<float>(Value->IntValue);
+                    Rhs[Lane] = static_cast<float>(Condition.CompareValue.IntValue);
+                    break;
+                case EBlackboardValueType::Bool:
+                    if (Op == EAIConditionOperator::Equal || Op == EAIConditionOperator::NotEqual)
+                    {
+                        Lhs[Lane] = Value->BoolValue ? 1.0f : 0.0f;
+                        Rhs[Lane] = Condition.CompareValue.BoolValue ? 1.0f : 0.0f;
+                    }
+                    else
+                    {
+                        Scalar[Lane] = 1;
+                    }
+                    break;
+                case EBlackboardValueType::Vector:
+                    Lhs[Lane] = Value->VectorValue.Size();
+                    Rhs[Lane] = Condition.CompareValue.VectorValue.Size();
+                    break;
+                default:
+                    Scalar[Lane] = 1;
+                    break;
+                }
+            }
+            break;
+
+        case EAIConditionType::Timer:
+            Op = EAIConditionOperator::GreaterOrEqual;
+            for (int32 Lane = 0; Lane < Num; ++Lane)
+            {
+                Lhs[Lane] = Batch[Pending[Lane]]->StateElapsedTime;
+                Rhs[Lane] = Condition.Seconds;
+                Scalar[Lane] = 0;
+            }
+            break;
+
+        case EAIConditionType::Distance:
+            Tolerance = EAIS::DistanceEqualTolerance;
+            for (int32 Lane = 0; Lane < Num; ++Lane)
+            {
+                const FAIInterpreter* Agent = Batch[Pending[Lane]];
+                FVector OwnerLocation = FVector::ZeroVector;
+                Scalar[Lane] = Agent->GetOwnerLocation(OwnerLocation) ? 0 : 2;
+                const FVector TargetLocation = Agent->GetSlotLocation(Condition.Slot);
+                Scratch.AX[Lane] = OwnerLocation.X;
+                Scratch.AY[Lane] = OwnerLocation.Y;
+                Scratch.AZ[Lane] = OwnerLocation.Z;
+                Scratch.BX[Lane] = TargetLocation.X;
+                Scratch.BY[Lane] = TargetLocation.Y;
+                Scratch.BZ[Lane] = TargetLocation.Z;
+                Rhs[Lane] = Condition.CompareDistance;
+            }
+            DistanceColumns(Scratch.AX.GetData(), Scratch.AY.GetData(), Scratch.AZ.GetData(),
+                            Scratch.BX.GetData(), Scratch.BY.GetData(), Scratch.BZ.GetData(), Lhs, Num);
+            break;
+
+        default:
+            // Composites and custom conditions are evaluated per agent
+            bVectorized = false;
+            break;
+        }
+
+        if (bVectorized)
+        {
+            CompareColumns(Lhs, Rhs, Op, Tolerance, Mask, Num);
+        }
+
+        // Resolve scalar lanes (1 = evaluate per agent, 2 = known failure) and retire agents whose condition passed
+        int32 Write = 0;
+        for (int32 Lane = 0; Lane < Num; ++Lane)
+        {
+            const int32 AgentIndex = Pending[Lane];
+            bool bPassed;
+            if (!bVectorized || Scalar[Lane] == 1)
+            {
+                bPassed = Batch[AgentIndex]->EvaluateCompiledCondition(Transitions[Rank].Condition);
+            }
+            else
+            {
+                bPassed = Scalar[Lane] == 0 && Mask[Lane] != 0;
+            }
+
+            if (bPassed)
+            {
+                OutTransitionRanks[AgentIndex] = Rank;
+            }
+            else
+            {
+                Pending[Write++] = AgentIndex;
+            }
+        }
+        Pending.SetNum(Write, false);
+    }
+
+    for (int32 Index = 0; Index < Batch.Num(); ++Index)
+    {
+        OutTransitionRanks[Index] = Batch[Index]->SelectEventTransition(OutTransitionRanks[Index]);
+    }
 }
@@ -0,0 +1,187 @@
+/*
+ * @Author: Punal Manalan
+ * @Description: Implementation of the EAIS Blueprint wait nodes
+ * @Date: 18/10/2026
+ */
+
+#include "EAISAsyncActions.h"
+#include "AIComponent.h"
+#include "Engine/World.h"
+#include "TimerManager.h"
+
+// ==================== UEAISAsyncWaitBase ====================
+
+void UEAISAsyncWaitBase::Activate()
+{
+    UAIComponent* AIComponent = Component.Get();
+    if (!AIComponent)
+    {
+        Finish(false);
+        return;
+    }
+
+    AIComponent->GetOnEndPlay().AddUObject(this, &UEAISAsyncWaitBase::HandleComponentEndPlay);
+
+    if (StartWaiting(*AIComponent) && bCompleteIfAlready)
+    {
+        Finish(true);
+        return;
+    }
+
+    UWorld* World = AIComponent->GetWorld();
+    if (TimeoutSeconds > 0.0f && World)
+    {
+        World->GetTimerManager().SetTimer(TimeoutHandle, this, &UEAISAsyncWaitBase::HandleTimeout, TimeoutSeconds, false);
+    }
+}
+
+void UEAISAsyncWaitBase::Finish(bool bSucceeded)
+{
+    if (bFinished)
+    {
+        return;
+    }
+    bFinished = true;
+
+    if (UAIComponent* AIComponent = Component.Get())
+    {
+        AIComponent->GetOnEndPlay().RemoveAll(this);
+        StopWaiting(*AIComponent);
+        if (UWorld* World = AIComponent->GetWorld())
+        {
+            World->GetTimerManager().ClearTimer(TimeoutHandle);
+        }
+    }
+
+    if (bSucceeded)
+    {
+        BroadcastCompleted();
+    }
+    else
+    {
+        BroadcastFailed();
+    }
+    SetReadyToDestroy();
+}
+
+void UEAISAsyncWaitBase::HandleTimeout()
+{
+    Finish(false);
+}
+
+void UEAISAsyncWaitBase::HandleComponentEndPlay()
+{
+    Finish(false);
+}
+
+// ==================== UEAISAsyncWaitForState ====================
+
+UEAISAsyncWaitForState* UEAISAsyncWaitForState::WaitForState(UAIComponent* AIComponent, const FString& StateId, float TimeoutSeconds, bool bCompleteIfAlreadyInState)
+{
+    UEAISAsyncWaitForState* Action = NewObject<UEAISAsyncWaitForState>();
+    Action->Component = AIComponent;
+    Action->TimeoutSeconds = TimeoutSeconds;
+    Action->bCompleteIfAlready = bCompleteIfAlreadyInState;
+    Action->StateName = FName(*StateId);
+    Action->RegisterWithGameInstance(AIComponent);
+    return Action;
+}
+
+bool UEAISAsyncWaitForState::StartWaiting(UAIComponent& AIComponent)
+{
+    AIComponent.GetOnStateChanged().AddUObject(this, &UEAISAsyncWaitForState::HandleStateChanged);
+    return AIComponent.GetInterpreter().GetCurrentStateName() == StateName;
+}
+
+void UEAISAsyncWaitForState::StopWaiting(UAIComponent& AIComponent)
+{
+    AIComponent.GetOnStateChanged().RemoveAll(this);
+}
+
+void UEAISAsyncWaitForState::HandleStateChanged(const FEAISStateChange& Change)
+{
+    if (Change.NewStateName == StateName)
+    {
+        Finish(true);
+    }
+}
+
+// ==================== UEAISAsyncWaitForBlackboardValue ====================
+
+UEAISAsyncWaitForBlackboardValue* UEAISAsyncWaitForBlackboardValue::WaitForBlackboardValue(UAIComponent* AIComponent, const FString& Key, const FBlackboardValue& Value, float TimeoutSeconds, bool bCompleteIfAlreadyMatching)
+{
+    UEAISAsyncWaitForBlackboardValue* Action = NewObject<UEAISAsyncWaitForBlackboardValue>();
+    Action->Component = AIComponent;
+    Action->TimeoutSeconds = TimeoutSeconds;
+    Action->bCompleteIfAlready = bCompleteIfAlreadyMatching;
+    Action->Key = Key;
+
+    // Blueprint callers may only fill Type and RawValue
+    Action->Expected = Value;
+    if (!Value.RawValue.IsEmpty())
+    {
+        Action->Expected.FromString(Value.RawValue);
+    }
+
+    Action->RegisterWithGameInstance(AIComponent);
+    return Action;
+}
+
+bool UEAISAsyncWaitForBlackboardValue::StartWaiting(UAIComponent& AIComponent)
+{
+    FAIInterpreter& Interpreter = AIComponent.GetInterpreter();
+    Interpreter.ObserveBlackboardKey(Key, FOnEAISBlackboardChanged::FDelegate::CreateUObject(this, &UEAISAsyncWaitForBlackboardValue::HandleValueChanged));
+
+    return Interpreter.GetBlackboardValue(Key, LastValue) && Matches(LastValue);
+}
+
+void UEAISAsyncWaitForBlackboardValue::StopWaiting(UAIComponent& AIComponent)
+{
+    AIComponent.GetInterpreter().RemoveBlackboardObservers(this, Key);
+}
+
+bool UEAISAsyncWaitForBlackboardValue::Matches(const FBlackboardValue& Value) const
+{
+    return Value.Type == Expected.Type && Value.Compare(Expected, EAIConditionOperator::Equal);
+}
+
+void UEAISAsyncWaitForBlackboardValue::HandleValueChanged(const FString& ChangedKey, const FBlackboardValue& Value)
+{
+    LastValue = Value;
+    if (Matches(Value))
+    {
+        Finish(true);
+    }
+}
+
+// ==================== UEAISAsyncWaitForEvent ====================
+
+UEAISAsyncWaitForEvent* UEAISAsyncWaitForEvent::WaitForEvent(UAIComponent* AIComponent, const FString& EventName, float TimeoutSeconds)
+{
+    UEAISAsyncWaitForEvent* Action = NewObject<UEAISAsyncWaitForEvent>();
+    Action->Component = AIComponent;
+    Action->TimeoutSeconds = TimeoutSeconds;
+    Action->EventName = EventName;
+    Action->RegisterWithGameInstance(AIComponent);
+    return Action;
+}
+
+bool UEAISAsyncWaitForEvent::StartWaiting(UAIComponent& AIComponent)
+{
+    AIComponent.GetOnEventReceived().AddUObject(this, &UEAISAsyncWaitForEvent::HandleEventReceived);
+    return false;
+}
+
+void UEAISAsyncWaitForEvent::StopWaiting(UAIComponent& AIComponent)
+{
+    AIComponent.GetOnEventReceived().RemoveAll(this);
+}
+
+void UEAISAsyncWaitForEvent::HandleEventReceived(const FString& ReceivedEvent, const FAIEventPayload& ReceivedPayload)
+{
+    if (ReceivedEvent.Equals(EventName, ESearchCase::IgnoreCase))
+    {
+        Payload = ReceivedPayload;
+        Finish(true);
+    }
+}
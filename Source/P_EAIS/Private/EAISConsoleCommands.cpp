@@ -293,12 +293,15 @@ void UEAISConsoleCommands::EmulateInputHandler(const TArray<FString>& Args)
     FString ActorName = Args[0];
     FString ActionName = Args[1];
     float Value = Args.Num() > 2 ? FCString::Atof(*Args[2]) : 1.0f;
+    const FName InputAction(*ActionName);
+    UEAISSubsystem* Subsystem = UEAISSubsystem::Get(World);
 
     // Find matching actors with AI components
     TArray<AActor*> AllActors;
     UGameplayStatics::GetAllActorsOfClass(World, AActor::StaticClass(), AllActors);
 
     int32 Count = 0;
+    int32 RoutedCount = 0;
     for (AActor* Actor : AllActors)
     {
         if (UAIComponent* AIComp = Actor->FindComponentByClass<UAIComponent>())
@@ -306,6 +309,12 @@ void UEAISConsoleCommands::EmulateInputHandler(const TArray<FString>& Args)
             FString Name = Actor->GetName();
             if (Name.Contains(ActorName) || ActorName.Equals(TEXT("*")))
             {
+                // Mapped actions also reach the AI as events ([EAIS.InputMapping])
+                if (Subsystem && Subsystem->RouteInputAction(Actor, InputAction))
+                {
+                    RoutedCount++;
+                }
+
                 // Get the controller and inject input via P_MEIS
                 APawn* Pawn = Cast<APawn>(Actor);
                 if (Pawn)
@@ -324,5 +333,5 @@ void UEAISConsoleCommands::EmulateInputHandler(const TArray<FString>& Args)
         }
     }
 
-    UE_LOG(LogTemp, Log, TEXT("EAIS.EmulateInput: Injected to %d actor(s)"), Count);
+    UE_LOG(LogTemp, Log, TEXT("EAIS.EmulateInput: Injected to %d actor(s), routed to %d AI(s)"), Count, RoutedCount);
 }
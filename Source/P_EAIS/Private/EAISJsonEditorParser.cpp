@@ -1,6 +1,7 @@
 // Copyright Punal Manalan. All Rights Reserved.
 
 #include "EAISJsonEditorParser.h"
+#include "AIBehaviour.h"
 #include "Dom/JsonObject.h"
 #include "Serialization/JsonReader.h"
 #include "Serialization/JsonSerializer.h"
@@ -18,6 +19,26 @@ bool FEAISJsonEditorParser::LoadFromJson(const FString& JsonString, FAIBehaviorD
     // Basic info
     OutDef.Name = RootObj->GetStringField(TEXT("name"));
     OutDef.InitialState = RootObj->GetStringField(TEXT("initialState"));
+    int32 MaxTransitions = 1;
+    if (RootObj->TryGetNumberField(TEXT("maxTransitionsPerTick"), MaxTransitions) ||
+        RootObj->TryGetNumberField(TEXT("MaxTransitionsPerTick"), MaxTransitions))
+    {
+        OutDef.MaxTransitionsPerTick = FMath::Max(1, MaxTransitions);
+    }
+
+    // Scoring queries (same format as the runtime parser)
+    const TArray<TSharedPtr<FJsonValue>>* QueriesArray;
+    if (RootObj->TryGetArrayField(TEXT("queries"), QueriesArray))
+    {
+        for (const auto& QueryVal : *QueriesArray)
+        {
+            FEAISQueryDef Query;
+            if (UAIBehaviour::ParseQueryJson(QueryVal->AsObject(), Query))
+            {
+                OutDef.Queries.Add(Query);
+            }
+        }
+    }
 
     // States
     const TArray<TSharedPtr<FJsonValue>>* StatesArray;
@@ -161,6 +182,10 @@ bool FEAISJsonEditorParser::SaveToJson(const FAIBehaviorDef& Def, const TMap<FSt
     TSharedRef<FJsonObject> RootObj = MakeShared<FJsonObject>();
     RootObj->SetStringField(TEXT("name"), Def.Name);
     RootObj->SetStringField(TEXT("initialState"), Def.InitialState);
+    if (Def.MaxTransitionsPerTick > 1)
+    {
+        RootObj->SetNumberField(TEXT("maxTransitionsPerTick"), Def.MaxTransitionsPerTick);
+    }
 
     // States
     TArray<TSharedPtr<FJsonValue>> StatesArray;
@@ -172,6 +197,17 @@ bool FEAISJsonEditorParser::SaveToJson(const FAIBehaviorDef& Def, const TMap<FSt
     }
     RootObj->SetArrayField(TEXT("states"), StatesArray);
 
+    // Queries
+    if (Def.Queries.Num() > 0)
+    {
+        TArray<TSharedPtr<FJsonValue>> QueriesArray;
+        for (const FEAISQueryDef& Query : Def.Queries)
+        {
+            QueriesArray.Add(MakeShared<FJsonValueObject>(UAIBehaviour::QueryToJson(Query)));
+        }
+        RootObj->SetArrayField(TEXT("queries"), QueriesArray);
+    }
+
     // Editor
     TSharedRef<FJsonObject> EditorObj = MakeShared<FJsonObject>();
     
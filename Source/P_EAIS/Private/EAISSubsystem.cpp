@@ -4,30 +4,876 @@
  * @Date: 29/12/2025
  */
 
-#include "EAISSubsystem.h"
 #include "EAISSubsystem.h"
 #include "AIAction.h"
+#include "AIComponent.h"
+#include "AIInterpreter.h"
+#include "EAISSettings.h"
+#include "EAIS_TargetProvider.h"
 #include "Misc/ConfigCacheIni.h"
 #include "AIBehaviour.h"
 #include "Engine/GameInstance.h"
+#include "Engine/World.h"
+#include "EngineUtils.h"
+#include "GameFramework/Pawn.h"
+#include "GameFramework/PlayerController.h"
+#include "AIController.h"
+#include "Navigation/PathFollowingComponent.h"
+#include "NavigationSystem.h"
+#include "NavigationData.h"
+#include "NavFilters/NavigationQueryFilter.h"
 #include "Misc/Paths.h"
 #include "HAL/FileManager.h"
 
-void UEAISSubsystem::Initialize(FSubsystemCollectionBase& Collection)
+void UEAISSubsystem::Initialize(FSubsystemCollectionBase& Collection)
+{
+    Super::Initialize(Collection);
+
+    const UEAISSettings* Settings = GetDefault<UEAISSettings>();
+    bUseAgentScheduler = Settings->bUseAgentScheduler;
+    bBatchTransitionEvaluation = Settings->bBatchTransitionEvaluation;
+    FrameBudgetMs = Settings->FrameBudgetMs;
+    StarvationWarningFrames = Settings->StarvationWarningFrames;
+    bUseFixedTimestep = Settings->bUseFixedTimestep;
+    FixedStepSeconds = 1.0f / FMath::Max(Settings->FixedTickRate, 1.0f);
+    MaxSubstepsPerFrame = FMath::Max(Settings->MaxSubstepsPerFrame, 1);
+    bAsyncPathfinding = Settings->bAsyncPathfinding;
+    MaxPathQueriesPerFrame = FMath::Max(Settings->MaxPathQueriesPerFrame, 1);
+    PathQueryShareDistance = Settings->PathQueryShareDistance;
+    MaxScoringQueriesPerFrame = FMath::Max(Settings->MaxScoringQueriesPerFrame, 1);
+    MaxPooledInterpretersPerProfile = FMath::Max(Settings->MaxPooledInterpretersPerProfile, 0);
+
+    RegisterDefaultActions();
+
+    UE_LOG(LogTemp, Log, TEXT("UEAISSubsystem: Initialized with %d actions"), ActionClasses.Num());
+}
+
+void UEAISSubsystem::Deinitialize()
+{
+    ActionClasses.Empty();
+    ActionInstances.Empty();
+    LoadedBehaviors.Empty();
+    ScheduledAgents.Empty();
+    DueAgents.Empty();
+    PendingMoves.Empty();
+    PathQueries.Empty();
+    InterpreterPool.Empty();
+
+    TeamBlackboards.Empty();
+    GlobalBlackboard->Values.Empty();
+
+    // The scoring task writes into ScoringJobs
+    ScoringTask.Wait();
+    PendingScoringJobs.Empty();
+    ScoringJobs.Empty();
+
+    Super::Deinitialize();
+}
+
+// ==================== FTickableGameObject ====================
+
+void UEAISSubsystem::Tick(float DeltaTime)
+{
+    // Paths found since last frame start moving before agents decide what to do next
+    DeliverPathResults();
+    DeliverScoringResults();
+
+    TickAgents(DeltaTime);
+
+    // MoveTo and RunQuery requests collected this frame (from scheduled and self-ticking agents alike)
+    DispatchPathQueries();
+    DispatchScoringQueries();
+}
+
+TStatId UEAISSubsystem::GetStatId() const
+{
+    RETURN_QUICK_DECLARE_CYCLE_STAT(UEAISSubsystem, STATGROUP_Tickables);
+}
+
+ETickableTickType UEAISSubsystem::GetTickableTickType() const
+{
+    return IsTemplate() ? ETickableTickType::Never : ETickableTickType::Conditional;
+}
+
+bool UEAISSubsystem::IsTickable() const
+{
+    return (bUseAgentScheduler && ScheduledAgents.Num() > 0) || PendingMoves.Num() > 0 || PathQueries.Num() > 0
+        || PendingScoringJobs.Num() > 0 || ScoringJobs.Num() > 0;
+}
+
+UWorld* UEAISSubsystem::GetTickableGameObjectWorld() const
+{
+    const UGameInstance* GameInstance = GetGameInstance();
+    return GameInstance ? GameInstance->GetWorld() : nullptr;
+}
+
+// ==================== Agent Scheduler ====================
+
+bool UEAISSubsystem::RegisterAgent(UAIComponent* Agent)
+{
+    if (!bUseAgentScheduler || !Agent)
+    {
+        return false;
+    }
+
+    ScheduledAgents.AddUnique(Agent);
+    return true;
+}
+
+void UEAISSubsystem::UnregisterAgent(UAIComponent* Agent)
+{
+    ScheduledAgents.Remove(Agent);
+}
+
+// ==================== Interpreter Pool ====================
+
+bool UEAISSubsystem::AcquireInterpreter(const TSharedPtr<const FEAISCompiledProgram>& Program, FAIInterpreter& Interpreter)
+{
+    TArray<FAIInterpreter>* Pool = Program.IsValid() ? InterpreterPool.Find(Program.Get()) : nullptr;
+    if (!Pool || Pool->Num() == 0)
+    {
+        return false;
+    }
+
+    Interpreter.TakeProgramStorage(Pool->Last());
+    Pool->Pop();
+    if (Pool->Num() == 0)
+    {
+        InterpreterPool.Remove(Program.Get());
+    }
+    return true;
+}
+
+void UEAISSubsystem::ReleaseInterpreter(FAIInterpreter& Interpreter)
+{
+    const TSharedPtr<const FEAISCompiledProgram>& Program = Interpreter.GetProgram();
+    if (!Program.IsValid())
+    {
+        return;
+    }
+
+    TArray<FAIInterpreter>& Pool = InterpreterPool.FindOrAdd(Program.Get());
+    if (Pool.Num() >= MaxPooledInterpretersPerProfile)
+    {
+        // Full: drop the storage, but still detach the agent from its program
+        FAIInterpreter Discarded;
+        Discarded.TakeProgramStorage(Interpreter);
+        if (Pool.Num() == 0)
+        {
+            InterpreterPool.Remove(Program.Get());
+        }
+        return;
+    }
+
+    Pool.AddDefaulted_GetRef().TakeProgramStorage(Interpreter);
+}
+
+int32 UEAISSubsystem::GetNumPooledInterpreters() const
+{
+    int32 NumPooled = 0;
+    for (const TPair<const FEAISCompiledProgram*, TArray<FAIInterpreter>>& Pair : InterpreterPool)
+    {
+        NumPooled += Pair.Value.Num();
+    }
+    return NumPooled;
+}
+
+void UEAISSubsystem::TickAgents(float DeltaTime)
+{
+    ScheduledAgents.RemoveAll([](const TWeakObjectPtr<UAIComponent>& Agent) { return !Agent.IsValid(); });
+
+    UpdateAgentLOD(DeltaTime);
+
+    NumDeferredAgents = 0;
+    const int32 NumAgents = ScheduledAgents.Num();
+    if (NumAgents == 0)
+    {
+        return;
+    }
+
+    // Collect agents whose tick interval has elapsed, starting where the last budgeted frame stopped.
+    // Woken agents (urgent events) go to the front so the frame budget never defers them.
+    RoundRobinCursor %= NumAgents;
+    DueAgents.Reset();
+    int32 NumWoken = 0;
+    for (int32 Offset = 0; Offset < NumAgents; ++Offset)
+    {
+        const int32 Index = (RoundRobinCursor + Offset) % NumAgents;
+        UAIComponent* Agent = ScheduledAgents[Index].Get();
+        if (!Agent->CanTickAI())
+        {
+            continue;
+        }
+
+        Agent->AccumulateTickTime(DeltaTime);
+        const float StepSeconds = bUseFixedTimestep ? Agent->GetFixedStepSeconds(FixedStepSeconds) : 0.0f;
+        const bool bWoken = Agent->IsWakeRequested();
+        if (bWoken || (bUseFixedTimestep ? Agent->GetAccumulatedTickTime() >= StepSeconds : Agent->IsTickDue()))
+        {
+            FEAISScheduledAgent Entry;
+            Entry.Agent = Agent;
+            Entry.Interpreter = &Agent->GetInterpreter();
+            Entry.DeltaSeconds = StepSeconds;
+            Entry.ScheduleIndex = Index;
+            if (bWoken)
+            {
+                DueAgents.Insert(Entry, NumWoken++);
+            }
+            else
+            {
+                DueAgents.Add(Entry);
+            }
+        }
+    }
+
+    // Process in slices until the frame budget is spent (the first slice always runs)
+    const double BudgetSeconds = FrameBudgetMs / 1000.0;
+    const double StartTime = FPlatformTime::Seconds();
+    int32 NumProcessed = 0;
+    while (NumProcessed < DueAgents.Num())
+    {
+        const int32 SliceEnd = BudgetSeconds > 0.0 ? FMath::Min(NumProcessed + BudgetSliceSize, DueAgents.Num()) : DueAgents.Num();
+        ProcessDueAgents(NumProcessed, SliceEnd);
+        NumProcessed = SliceEnd;
+
+        if (BudgetSeconds > 0.0 && FPlatformTime::Seconds() - StartTime >= BudgetSeconds)
+        {
+            break;
+        }
+    }
+
+    // Deferred agents keep their accumulated time and go first next frame
+    NumDeferredAgents = DueAgents.Num() - NumProcessed;
+    if (NumDeferredAgents == 0)
+    {
+        return;
+    }
+
+    RoundRobinCursor = DueAgents[NumProcessed].ScheduleIndex;
+    for (int32 Index = NumProcessed; Index < DueAgents.Num(); ++Index)
+    {
+        UAIComponent* Agent = DueAgents[Index].Agent;
+        if (!IsValid(Agent))
+        {
+            continue;
+        }
+
+        const int32 DeferredFrames = Agent->MarkTickDeferred();
+        if (StarvationWarningFrames > 0 && DeferredFrames == StarvationWarningFrames)
+        {
+            ++NumStarvationReports;
+            UE_LOG(LogTemp, Warning, TEXT("UEAISSubsystem: Agent '%s' deferred for %d consecutive frames by the %.2f ms AI budget (%d due, %d processed)"),
+                *GetNameSafe(Agent->GetOwner()), DeferredFrames, FrameBudgetMs, DueAgents.Num(), NumProcessed);
+        }
+    }
+}
+
+void UEAISSubsystem::ProcessDueAgents(int32 Begin, int32 End)
+{
+    int32 NumRounds = 0;
+    for (int32 Index = Begin; Index < End; ++Index)
+    {
+        FEAISScheduledAgent& Entry = DueAgents[Index];
+        Entry.NumSteps = 0;
+        if (!IsValid(Entry.Agent))
+        {
+            continue;
+        }
+
+        if (bUseFixedTimestep)
+        {
+            // DeltaSeconds already holds this agent's step length
+            Entry.NumSteps = Entry.Agent->ConsumeFixedSteps(Entry.DeltaSeconds, MaxSubstepsPerFrame);
+        }
+        else
+        {
+            Entry.DeltaSeconds = Entry.Agent->ConsumeTickTime();
+            Entry.NumSteps = 1;
+        }
+        NumRounds = FMath::Max(NumRounds, Entry.NumSteps);
+    }
+
+    // Substeps run in rounds so every round can still be batched across agents
+    for (int32 Round = 0; Round < NumRounds; ++Round)
+    {
+        RunTickRound(Begin, End, Round);
+    }
+
+    // Observers hear about each agent's blackboard once per frame, however many substeps ran
+    for (int32 Index = Begin; Index < End; ++Index)
+    {
+        const FEAISScheduledAgent& Entry = DueAgents[Index];
+        if (Entry.NumSteps > 0 && IsValid(Entry.Agent))
+        {
+            Entry.Agent->DispatchBlackboardChanges();
+        }
+    }
+}
+
+void UEAISSubsystem::RunTickRound(int32 Begin, int32 End, int32 Round)
+{
+    if (!bBatchTransitionEvaluation)
+    {
+        for (int32 Index = Begin; Index < End; ++Index)
+        {
+            const FEAISScheduledAgent& Entry = DueAgents[Index];
+            if (Entry.NumSteps > Round && IsValid(Entry.Agent))
+            {
+                Entry.Agent->TickAI(Entry.DeltaSeconds);
+            }
+        }
+        return;
+    }
+
+    // Phase 1: timers, events and OnTick actions (these may change state or blackboard)
+    for (int32 Index = Begin; Index < End; ++Index)
+    {
+        FEAISScheduledAgent& Entry = DueAgents[Index];
+        Entry.bActive = Entry.NumSteps > Round && IsValid(Entry.Agent) && Entry.Interpreter->BeginTick(Entry.DeltaSeconds);
+    }
+
+    // Phase 2: side-effect free transition selection, batched by (program, state)
+    SelectTransitionsBatched(Begin, End);
+
+    // Phase 3: apply transitions in schedule order so OnExit/OnEnter side effects stay deterministic
+    for (int32 Index = Begin; Index < End; ++Index)
+    {
+        const FEAISScheduledAgent& Entry = DueAgents[Index];
+        if (Entry.bActive && IsValid(Entry.Agent))
+        {
+            Entry.Interpreter->EndTick(Entry.TransitionRank, Entry.SelectedProgram, Entry.SelectedState);
+        }
+    }
+}
+
+void UEAISSubsystem::SelectTransitionsBatched(int32 Begin, int32 End)
+{
+    BatchOrder.Reset();
+    for (int32 Index = Begin; Index < End; ++Index)
+    {
+        DueAgents[Index].TransitionRank = INDEX_NONE;
+        if (DueAgents[Index].bActive)
+        {
+            BatchOrder.Add(Index);
+        }
+    }
+
+    auto SameGroup = [this](int32 A, int32 B)
+    {
+        const FAIInterpreter& IA = *DueAgents[A].Interpreter;
+        const FAIInterpreter& IB = *DueAgents[B].Interpreter;
+        return IA.GetProgram() == IB.GetProgram() && IA.GetCurrentStateIndex() == IB.GetCurrentStateIndex();
+    };
+
+    BatchOrder.Sort([this](int32 A, int32 B)
+    {
+        const FAIInterpreter& IA = *DueAgents[A].Interpreter;
+        const FAIInterpreter& IB = *DueAgents[B].Interpreter;
+        const FEAISCompiledProgram* ProgramA = IA.GetProgram().Get();
+        const FEAISCompiledProgram* ProgramB = IB.GetProgram().Get();
+        if (ProgramA != ProgramB)
+        {
+            return TLess<const FEAISCompiledProgram*>()(ProgramA, ProgramB);
+        }
+        if (IA.GetCurrentStateIndex() != IB.GetCurrentStateIndex())
+        {
+            return IA.GetCurrentStateIndex() < IB.GetCurrentStateIndex();
+        }
+        return A < B;
+    });
+
+    TArray<FAIInterpreter*, TInlineAllocator<32>> Batch;
+    TArray<int32, TInlineAllocator<32>> Ranks;
+
+    int32 RunStart = 0;
+    while (RunStart < BatchOrder.Num())
+    {
+        int32 RunEnd = RunStart + 1;
+        while (RunEnd < BatchOrder.Num() && SameGroup(BatchOrder[RunStart], BatchOrder[RunEnd]))
+        {
+            ++RunEnd;
+        }
+
+        Batch.Reset();
+        for (int32 Index = RunStart; Index < RunEnd; ++Index)
+        {
+            Batch.Add(DueAgents[BatchOrder[Index]].Interpreter);
+        }
+        Ranks.SetNumUninitialized(Batch.Num());
+
+        FAIInterpreter::SelectTransitionsBatch(Batch, Ranks, BatchScratch);
+
+        for (int32 Index = RunStart; Index < RunEnd; ++Index)
+        {
+            FEAISScheduledAgent& Entry = DueAgents[BatchOrder[Index]];
+            Entry.TransitionRank = Ranks[Index - RunStart];
+            Entry.SelectedProgram = Entry.Interpreter->GetProgram().Get();
+            Entry.SelectedState = Entry.Interpreter->GetCurrentStateIndex();
+        }
+
+        RunStart = RunEnd;
+    }
+}
+
+// ==================== Tick LOD ====================
+
+namespace
+{
+    /** Minimum time between searches for tagged focus actors while none are found */
+    constexpr double FocusActorSearchCooldown = 1.0;
+}
+
+void UEAISSubsystem::UpdateAgentLOD(float DeltaTime)
+{
+    const UEAISSettings* Settings = GetDefault<UEAISSettings>();
+    if (!Settings->bEnableDistanceLOD)
+    {
+        if (bLODApplied)
+        {
+            for (const TWeakObjectPtr<UAIComponent>& Agent : ScheduledAgents)
+            {
+                Agent->SetLODTickInterval(0.0f);
+            }
+            bLODApplied = false;
+        }
+        return;
+    }
+
+    LODUpdateTimer -= DeltaTime;
+    if (LODUpdateTimer > 0.0f)
+    {
+        return;
+    }
+    LODUpdateTimer = Settings->LODUpdateInterval;
+
+    UWorld* World = GetTickableGameObjectWorld();
+    if (!World)
+    {
+        return;
+    }
+
+    GatherLODFocusPoints(*World, Settings->LODFocusActorTag);
+    bLODApplied = true;
+
+    // Interpolate the tick period between the near and far rates
+    const float NearInterval = Settings->LODNearTickRate > 0.0f ? 1.0f / Settings->LODNearTickRate : 0.0f;
+    const float FarInterval = 1.0f / FMath::Max(Settings->LODFarTickRate, 0.1f);
+    const bool bCheckRelevancy = Settings->bLODUseNetRelevancy && World->GetNetMode() != NM_Standalone;
+
+    for (const TWeakObjectPtr<UAIComponent>& WeakAgent : ScheduledAgents)
+    {
+        UAIComponent* Agent = WeakAgent.Get();
+        const AActor* Body = Agent->GetOwnerPawn();
+        if (!Body)
+        {
+            Body = Agent->GetOwner();
+        }
+
+        // Without anything to measure against, never throttle
+        if (!Agent->bAllowTickLOD || !Body || LODFocusPoints.Num() == 0)
+        {
+            Agent->SetLODTickInterval(0.0f);
+            continue;
+        }
+
+        if (bCheckRelevancy && !IsRelevantToAnyPlayer(*World, *Body))
+        {
+            Agent->SetLODTickInterval(FarInterval);
+            continue;
+        }
+
+        const FVector Location = Body->GetActorLocation();
+        double MinDistanceSq = TNumericLimits<double>::Max();
+        for (const FVector& FocusPoint : LODFocusPoints)
+        {
+            MinDistanceSq = FMath::Min(MinDistanceSq, FVector::DistSquared(Location, FocusPoint));
+        }
+
+        const float Distance = static_cast<float>(FMath::Sqrt(MinDistanceSq));
+        const float Range = Settings->LODFarDistance - Settings->LODNearDistance;
+        const float Alpha = Range > 0.0f
+            ? FMath::Clamp((Distance - Settings->LODNearDistance) / Range, 0.0f, 1.0f)
+            : (Distance > Settings->LODNearDistance ? 1.0f : 0.0f);
+
+        Agent->SetLODTickInterval(FMath::Lerp(NearInterval, FarInterval, Alpha));
+    }
+}
+
+void UEAISSubsystem::GatherLODFocusPoints(UWorld& World, FName FocusTag)
+{
+    LODFocusPoints.Reset();
+
+    // Only human players (a local player or a net connection): bots possessed by a PlayerController
+    // for input injection would otherwise be their own focus point and never be throttled
+    for (FConstPlayerControllerIterator It = World.GetPlayerControllerIterator(); It; ++It)
+    {
+        const APlayerController* PC = It->Get();
+        if (const APawn* Pawn = PC && PC->Player ? PC->GetPawn() : nullptr)
+        {
+            LODFocusPoints.Add(Pawn->GetActorLocation());
+        }
+    }
+
+    if (FocusTag.IsNone())
+    {
+        return;
+    }
+
+    LODFocusActors.RemoveAll([](const TWeakObjectPtr<AActor>& Actor) { return !Actor.IsValid(); });
+    if (LODFocusActors.Num() == 0 && World.GetTimeSeconds() >= NextFocusActorSearchTime)
+    {
+        NextFocusActorSearchTime = World.GetTimeSeconds() + FocusActorSearchCooldown;
+        for (TActorIterator<AActor> It(&World); It; ++It)
+        {
+            if (It->ActorHasTag(FocusTag))
+            {
+                LODFocusActors.Add(*It);
+            }
+        }
+    }
+
+    for (const TWeakObjectPtr<AActor>& Actor : LODFocusActors)
+    {
+        LODFocusPoints.Add(Actor->GetActorLocation());
+    }
+}
+
+bool UEAISSubsystem::IsRelevantToAnyPlayer(UWorld& World, const AActor& Actor)
+{
+    for (FConstPlayerControllerIterator It = World.GetPlayerControllerIterator(); It; ++It)
+    {
+        const APlayerController* PC = It->Get();
+        if (!PC || !PC->Player)
+        {
+            continue;
+        }
+
+        FVector ViewLocation;
+        FRotator ViewRotation;
+        PC->GetPlayerViewPoint(ViewLocation, ViewRotation);
+
+        const AActor* ViewTarget = PC->GetViewTarget();
+        if (Actor.IsNetRelevantFor(PC, ViewTarget ? ViewTarget : PC, ViewLocation))
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+// ==================== Input Routing ====================
+
+bool UEAISSubsystem::RouteInputAction(AActor* Target, FName InputAction, bool bUrgent)
+{
+    UAIComponent* Agent = FindInputTarget(Target);
+    if (!Agent || !Agent->HandleInputAction(InputAction, bUrgent))
+    {
+        return false;
+    }
+
+    ++NumRoutedInputs;
+    return true;
+}
+
+UAIComponent* UEAISSubsystem::FindInputTarget(AActor* Target)
+{
+    if (!Target)
+    {
+        return nullptr;
+    }
+
+    if (UAIComponent* Agent = Target->FindComponentByClass<UAIComponent>())
+    {
+        return Agent;
+    }
+
+    // Input arrives on the controller while the AI may live on the pawn, or the other way around
+    AActor* Other = nullptr;
+    if (const AController* Controller = Cast<AController>(Target))
+    {
+        Other = Controller->GetPawn();
+    }
+    else if (const APawn* Pawn = Cast<APawn>(Target))
+    {
+        Other = Pawn->GetController();
+    }
+    return Other ? Other->FindComponentByClass<UAIComponent>() : nullptr;
+}
+
+// ==================== Movement ====================
+
+namespace
+{
+    /** Frames a path query waits for its async callback before its moves fail */
+    constexpr uint64 MaxPathQueryWaitFrames = 300;
+}
+
+EAIActionStatus UEAISSubsystem::RequestMove(UAIComponent* Agent, const FVector& Goal, const FAIActionParams& Params)
+{
+    UWorld* World = Agent ? Agent->GetWorld() : nullptr;
+    APawn* Pawn = Agent ? Agent->GetOwnerPawn() : nullptr;
+    AAIController* AIController = Pawn ? Cast<AAIController>(Pawn->GetController()) : nullptr;
+    if (!World || !AIController)
+    {
+        return EAIActionStatus::Failed;
+    }
+
+    FEAISMoveRequestState& Move = Agent->GetMoveState();
+    const double Now = World->GetTimeSeconds();
+
+    if (Move.bHasGoal)
+    {
+        const bool bSameGoal = FVector::DistSquared(Move.Goal, Goal) <= FMath::Square(Params.RetargetDistance);
+        const bool bSameFrame = Move.RequestFrame == GFrameCounter;
+        const bool bMoving = Move.Status == EAIActionStatus::Running
+            && (Move.bPathPending || AIController->GetMoveStatus() != EPathFollowingStatus::Idle);
+
+        // Same goal this frame or while still moving, or a retarget sooner than the interval allows
+        if ((bSameGoal && (bSameFrame || bMoving)) || (bMoving && (Now - Move.RequestTime) < Params.RetargetInterval))
+        {
+            ++NumCoalescedMoveRequests;
+            return Move.Status;
+        }
+    }
+
+    ++NumMoveRequests;
+    Move.Goal = Goal;
+    Move.RequestTime = Now;
+    Move.RequestFrame = GFrameCounter;
+    Move.bHasGoal = true;
+    Move.bPathPending = false;
+
+    if (bAsyncPathfinding)
+    {
+        if (FVector::DistSquared2D(Pawn->GetNavAgentLocation(), Goal) <= FMath::Square(Params.AcceptanceRadius))
+        {
+            Move.Status = EAIActionStatus::Succeeded;
+            return Move.Status;
+        }
+
+        // One pending entry per agent; the latest goal wins
+        FEAISPendingMove* Pending = PendingMoves.FindByPredicate([Agent](const FEAISPendingMove& Item) { return Item.Agent.Get() == Agent; });
+        if (!Pending)
+        {
+            Pending = &PendingMoves.AddDefaulted_GetRef();
+            Pending->Agent = Agent;
+        }
+        Pending->Goal = Goal;
+        Pending->AcceptanceRadius = Params.AcceptanceRadius;
+
+        Move.bPathPending = true;
+        Move.Status = EAIActionStatus::Running;
+        return Move.Status;
+    }
+
+    const EPathFollowingRequestResult::Type Result = AIController->MoveToLocation(Goal, Params.AcceptanceRadius, true, true, true, true);
+
+    if (Result == EPathFollowingRequestResult::Failed)
+    {
+        UE_LOG(LogTemp, Error, TEXT("UEAISSubsystem: MoveToLocation FAILED for %s -> %s. NavMesh might be missing or target unreachable."), *Pawn->GetName(), *Goal.ToString());
+        Move.Status = EAIActionStatus::Failed;
+    }
+    else
+    {
+        UE_LOG(LogTemp, Verbose, TEXT("UEAISSubsystem: MoveToLocation Request: %s"), *UEnum::GetValueAsString(Result));
+        Move.Status = Result == EPathFollowingRequestResult::AlreadyAtGoal ? EAIActionStatus::Succeeded : EAIActionStatus::Running;
+    }
+
+    return Move.Status;
+}
+
+FIntVector UEAISSubsystem::GetPathShareCell(const FVector& Location) const
+{
+    const double CellSize = FMath::Max<double>(PathQueryShareDistance, 1.0);
+    return FIntVector(FMath::FloorToInt32(Location.X / CellSize), FMath::FloorToInt32(Location.Y / CellSize), FMath::FloorToInt32(Location.Z / CellSize));
+}
+
+void UEAISSubsystem::DispatchPathQueries()
+{
+    if (PendingMoves.Num() == 0)
+    {
+        return;
+    }
+
+    UWorld* World = GetTickableGameObjectWorld();
+    UNavigationSystemV1* NavSys = FNavigationSystem::GetCurrent<UNavigationSystemV1>(World);
+
+    // Queries still in flight can take more agents
+    TMap<FEAISPathShareKey, int32> QueryByKey;
+    if (PathQueryShareDistance > 0.0f)
+    {
+        for (int32 Index = 0; Index < PathQueries.Num(); ++Index)
+        {
+            if (!PathQueries[Index].bFinished)
+            {
+                QueryByKey.Add(PathQueries[Index].ShareKey, Index);
+            }
+        }
+    }
+
+    int32 NumDispatched = 0;
+    int32 NumKept = 0;
+    for (int32 Index = 0; Index < PendingMoves.Num(); ++Index)
+    {
+        const FEAISPendingMove& Pending = PendingMoves[Index];
+        UAIComponent* Agent = Pending.Agent.Get();
+        APawn* Pawn = Agent ? Agent->GetOwnerPawn() : nullptr;
+        AAIController* AIController = Pawn ? Cast<AAIController>(Pawn->GetController()) : nullptr;
+
+        // Superseded by a newer goal or aborted since it was queued
+        if (!AIController || !Agent->GetMoveState().bPathPending || !Agent->GetMoveState().Goal.Equals(Pending.Goal))
+        {
+            continue;
+        }
+
+        // Agents with other nav properties (capsule size) or filters must not follow each other's paths
+        const FVector Start = Pawn->GetNavAgentLocation();
+        const FNavAgentProperties& AgentProps = AIController->GetNavAgentPropertiesRef();
+        const ANavigationData* NavData = NavSys ? NavSys->GetNavDataForProps(AgentProps, Start) : nullptr;
+
+        FEAISPathShareKey ShareKey;
+        ShareKey.NavData = NavData;
+        ShareKey.FilterClass = AIController->GetDefaultNavigationFilterClass().Get();
+        ShareKey.StartCell = GetPathShareCell(Start);
+        ShareKey.GoalCell = GetPathShareCell(Pending.Goal);
+        if (const int32* Shared = NavData ? QueryByKey.Find(ShareKey) : nullptr)
+        {
+            PathQueries[*Shared].Moves.Add(Pending);
+            continue;
+        }
+
+        if (NumDispatched >= MaxPathQueriesPerFrame)
+        {
+            PendingMoves[NumKept++] = Pending;
+            continue;
+        }
+
+        uint32 QueryId = INVALID_NAVQUERYID;
+        if (NavData)
+        {
+            FPathFindingQuery Query(AIController, *NavData, Start, Pending.Goal,
+                UNavigationQueryFilter::GetQueryFilter(*NavData, AIController, AIController->GetDefaultNavigationFilterClass()));
+            Query.SetAllowPartialPaths(true);
+            QueryId = NavSys->FindPathAsync(AgentProps, Query, FNavPathQueryDelegate::CreateUObject(this, &UEAISSubsystem::OnPathQueryFinished), EPathFindingMode::Regular);
+        }
+
+        if (QueryId == INVALID_NAVQUERYID)
+        {
+            UE_LOG(LogTemp, Error, TEXT("UEAISSubsystem: Path query FAILED for %s -> %s. NavMesh might be missing."), *Pawn->GetName(), *Pending.Goal.ToString());
+            Agent->GetMoveState().bPathPending = false;
+            Agent->GetMoveState().Status = EAIActionStatus::Failed;
+            continue;
+        }
+
+        FEAISPathQuery& PathQuery = PathQueries.AddDefaulted_GetRef();
+        PathQuery.QueryId = QueryId;
+        PathQuery.ShareKey = ShareKey;
+        PathQuery.DispatchFrame = GFrameCounter;
+        PathQuery.Moves.Add(Pending);
+        if (PathQueryShareDistance > 0.0f)
+        {
+            QueryByKey.Add(ShareKey, PathQueries.Num() - 1);
+        }
+
+        ++NumDispatched;
+        ++NumPathQueries;
+    }
+
+    PendingMoves.SetNum(NumKept, false);
+}
+
+void UEAISSubsystem::OnPathQueryFinished(uint32 QueryId, ENavigationQueryResult::Type Result, FNavPathSharedPtr Path)
+{
+    FEAISPathQuery* Query = PathQueries.FindByPredicate([QueryId](const FEAISPathQuery& Item) { return Item.QueryId == QueryId; });
+    if (Query)
+    {
+        Query->bFinished = true;
+        Query->bSucceeded = Result == ENavigationQueryResult::Success && Path.IsValid() && Path->IsValid();
+        Query->Path = Path;
+    }
+}
+
+void UEAISSubsystem::DeliverPathResults()
+{
+    for (int32 Index = 0; Index < PathQueries.Num();)
+    {
+        FEAISPathQuery& Query = PathQueries[Index];
+        if (!Query.bFinished)
+        {
+            // The callback may never arrive (e.g. nav data unregistered); fail the moves instead of waiting forever
+            if (GFrameCounter - Query.DispatchFrame < MaxPathQueryWaitFrames)
+            {
+                ++Index;
+                continue;
+            }
+            UE_LOG(LogTemp, Warning, TEXT("UEAISSubsystem: Path query %u timed out after %llu frames"), Query.QueryId, MaxPathQueryWaitFrames);
+            Query.bFinished = true;
+            Query.bSucceeded = false;
+        }
+
+        for (int32 MoveIndex = 0; MoveIndex < Query.Moves.Num(); ++MoveIndex)
+        {
+            DeliverPath(Query, Query.Moves[MoveIndex], MoveIndex == 0);
+        }
+        PathQueries.RemoveAtSwap(Index, 1, false);
+    }
+}
+
+void UEAISSubsystem::DeliverPath(const FEAISPathQuery& Query, const FEAISPendingMove& Pending, bool bOwnsPath)
 {
-    Super::Initialize(Collection);
+    UAIComponent* Agent = Pending.Agent.Get();
+    if (!Agent)
+    {
+        return;
+    }
 
-    RegisterDefaultActions();
+    // Superseded or aborted while the query was in flight
+    FEAISMoveRequestState& Move = Agent->GetMoveState();
+    if (!Move.bPathPending || !Move.Goal.Equals(Pending.Goal))
+    {
+        return;
+    }
+    Move.bPathPending = false;
 
-    UE_LOG(LogTemp, Log, TEXT("UEAISSubsystem: Initialized with %d actions"), ActionClasses.Num());
-}
+    APawn* Pawn = Agent->GetOwnerPawn();
+    AAIController* AIController = Pawn ? Cast<AAIController>(Pawn->GetController()) : nullptr;
+    if (!AIController || !Query.bSucceeded)
+    {
+        UE_LOG(LogTemp, Warning, TEXT("UEAISSubsystem: No path for %s -> %s"), Pawn ? *Pawn->GetName() : TEXT("None"), *Pending.Goal.ToString());
+        Move.Status = EAIActionStatus::Failed;
+        return;
+    }
 
-void UEAISSubsystem::Deinitialize()
-{
-    ActionClasses.Empty();
-    ActionInstances.Empty();
+    // Agents sharing the query follow a copy of the points that starts at their own location
+    FNavPathSharedPtr Path = Query.Path;
+    if (!bOwnsPath)
+    {
+        TArray<FVector> Points;
+        Points.Reserve(Query.Path->GetPathPoints().Num());
+        for (const FNavPathPoint& Point : Query.Path->GetPathPoints())
+        {
+            Points.Add(Point.Location);
+        }
+        Points[0] = Pawn->GetNavAgentLocation();
 
-    Super::Deinitialize();
+        // The shared path ends at the first agent's goal, up to a cell away from this one's
+        if (Points.Num() > 1 && !Query.Path->IsPartial())
+        {
+            Points.Last() = Pending.Goal;
+        }
+
+        Path = MakeShared<FNavigationPath, ESPMode::ThreadSafe>(Points, nullptr);
+        Path->SetNavigationDataUsed(Query.Path->GetNavigationDataUsed());
+    }
+
+    FAIMoveRequest MoveRequest(Pending.Goal);
+    MoveRequest.SetAcceptanceRadius(Pending.AcceptanceRadius);
+    MoveRequest.SetReachTestIncludesAgentRadius(true);
+    MoveRequest.SetAllowPartialPath(true);
+    MoveRequest.SetCanStrafe(true);
+
+    const FAIRequestID RequestId = AIController->RequestMove(MoveRequest, Path);
+    Move.Status = RequestId.IsValid() ? EAIActionStatus::Running : EAIActionStatus::Failed;
 }
 
 UEAISSubsystem* UEAISSubsystem::Get(UObject* WorldContextObject)
@@ -60,6 +906,7 @@ void UEAISSubsystem::RegisterAction(const FString& ActionName, TSubclassOf<UAIAc
     }
 
     ActionClasses.Add(ActionName, ActionClass);
+    UAIAction::RegisterActionClass(ActionName, ActionClass);
     
     // Invalidate cached instance
     ActionInstances.Remove(ActionName);
@@ -110,6 +957,15 @@ bool UEAISSubsystem::IsActionRegistered(const FString& ActionName) const
 
 UAIBehaviour* UEAISSubsystem::LoadBehaviorFromFile(const FString& FilePath)
 {
+    // Respawned agents ask for the same path again; skip the search and the disk
+    if (UAIBehaviour** Known = LoadedBehaviors.Find(FilePath))
+    {
+        if (*Known && (*Known)->IsValid())
+        {
+            return *Known;
+        }
+    }
+
     // Collect all search paths
     TArray<FString> SearchPaths;
     SearchPaths.Add(FPaths::ProjectContentDir() / TEXT("AIProfiles")); // Default
@@ -184,6 +1040,15 @@ UAIBehaviour* UEAISSubsystem::LoadBehaviorFromFile(const FString& FilePath)
         return nullptr;
     }
 
+    // Reuse behaviors already loaded from this file so agents share one compiled program
+    if (UAIBehaviour** Cached = LoadedBehaviors.Find(ValidPath))
+    {
+        if (*Cached && (*Cached)->IsValid())
+        {
+            return *Cached;
+        }
+    }
+
     UAIBehaviour* Behavior = NewObject<UAIBehaviour>(this);
     Behavior->JsonFilePath = FilePath; // Keep relative identifier
     
@@ -207,6 +1072,8 @@ UAIBehaviour* UEAISSubsystem::LoadBehaviorFromFile(const FString& FilePath)
     // Usually fine to keep full path or just the name. 
     // But let's stick to ValidPath which ensures it works.
 
+    LoadedBehaviors.Add(ValidPath, Behavior);
+    LoadedBehaviors.Add(FilePath, Behavior);
     return Behavior;
 }
 
@@ -286,6 +1153,444 @@ void UEAISSubsystem::SetGlobalDebugMode(bool bEnabled)
     UE_LOG(LogTemp, Log, TEXT("UEAISSubsystem: Global debug mode %s"), bEnabled ? TEXT("ENABLED") : TEXT("DISABLED"));
 }
 
+// ==================== Team Queries ====================
+
+void UEAISSubsystem::RegisterQueryActor(AActor* Actor)
+{
+    if (!Actor || FindQueryActor(Actor) != INDEX_NONE)
+    {
+        return;
+    }
+
+    // Manually registered actors may be destroyed without unregistering
+    QueryActors.RemoveAllSwap([](const FEAISQueryActor& Existing) { return !Existing.Actor.IsValid(); });
+
+    FEAISQueryActor& Entry = QueryActors.AddDefaulted_GetRef();
+    Entry.Actor = Actor;
+    CacheTeamInfo(Entry);
+}
+
+void UEAISSubsystem::UnregisterQueryActor(AActor* Actor)
+{
+    const int32 Index = FindQueryActor(Actor);
+    if (Index != INDEX_NONE)
+    {
+        QueryActors.RemoveAtSwap(Index);
+    }
+}
+
+void UEAISSubsystem::RefreshQueryActor(AActor* Actor)
+{
+    const int32 Index = FindQueryActor(Actor);
+    if (Index == INDEX_NONE)
+    {
+        return;
+    }
+
+    CacheTeamInfo(QueryActors[Index]);
+
+    // A team change moves the agent to the new team's blackboard
+    const APawn* Pawn = Cast<APawn>(Actor);
+    UAIComponent* Agent = Actor->FindComponentByClass<UAIComponent>();
+    if (!Agent && Pawn && Pawn->GetController())
+    {
+        Agent = Pawn->GetController()->FindComponentByClass<UAIComponent>();
+    }
+    BindSharedBlackboards(Agent);
+}
+
+int32 UEAISSubsystem::GetCachedTeamId(const AActor* Actor) const
+{
+    const int32 Index = FindQueryActor(Actor);
+    return Index != INDEX_NONE ? QueryActors[Index].TeamId : 0;
+}
+
+void UEAISSubsystem::CacheTeamInfo(FEAISQueryActor& Entry)
+{
+    Entry.TeamId = 0;
+    Entry.Role = NAME_None;
+
+    AActor* Actor = Entry.Actor.Get();
+    if (Actor && Actor->Implements<UEAIS_TargetProvider>())
+    {
+        Entry.TeamId = IEAIS_TargetProvider::Execute_EAIS_GetTeamId(Actor);
+        const FString Role = IEAIS_TargetProvider::Execute_EAIS_GetRole(Actor);
+        Entry.Role = Role.IsEmpty() ? NAME_None : FName(*Role);
+    }
+}
+
+int32 UEAISSubsystem::FindQueryActor(const AActor* Actor) const
+{
+    return Actor ? QueryActors.IndexOfByPredicate([Actor](const FEAISQueryActor& Entry) { return Entry.Actor.Get() == Actor; }) : INDEX_NONE;
+}
+
+template <typename FunctorType>
+void UEAISSubsystem::ForEachQueryActor(const AActor* Querier, const FEAISQueryFilter& Filter, FunctorType&& Visit) const
+{
+    // Team ids are cached, so filtering never calls into the provider (or Blueprint)
+    const int32 QuerierTeam = GetCachedTeamId(Querier);
+    for (const FEAISQueryActor& Entry : QueryActors)
+    {
+        const AActor* Actor = Entry.Actor.Get();
+        if (!Actor || (Filter.bExcludeSelf && Actor == Querier))
+        {
+            continue;
+        }
+
+        if ((Filter.Team == EEAISTeamFilter::Allies && (QuerierTeam == 0 || Entry.TeamId != QuerierTeam))
+            || (Filter.Team == EEAISTeamFilter::Enemies && Entry.TeamId == QuerierTeam)
+            || (!Filter.Role.IsNone() && Entry.Role != Filter.Role))
+        {
+            continue;
+        }
+
+        Visit(*Actor, Actor->GetActorLocation());
+    }
+}
+
+AActor* UEAISSubsystem::FindNearest(const AActor* Querier, const FVector& Origin, const FEAISQueryFilter& Filter, float MaxDistance) const
+{
+    const AActor* Nearest = nullptr;
+    float NearestDistSq = MaxDistance > 0.0f ? FMath::Square(MaxDistance) : MAX_flt;
+    ForEachQueryActor(Querier, Filter, [&](const AActor& Actor, const FVector& Location)
+    {
+        const float DistSq = FVector::DistSquared(Origin, Location);
+        if (DistSq < NearestDistSq)
+        {
+            NearestDistSq = DistSq;
+            Nearest = &Actor;
+        }
+    });
+    return const_cast<AActor*>(Nearest);
+}
+
+void UEAISSubsystem::FindInRadius(const AActor* Querier, const FVector& Origin, float Radius, const FEAISQueryFilter& Filter, TArray<AActor*>& OutActors) const
+{
+    OutActors.Reset();
+    const float RadiusSq = FMath::Square(Radius);
+    ForEachQueryActor(Querier, Filter, [&](const AActor& Actor, const FVector& Location)
+    {
+        if (FVector::DistSquared(Origin, Location) <= RadiusSq)
+        {
+            OutActors.Add(const_cast<AActor*>(&Actor));
+        }
+    });
+}
+
+AActor* UEAISSubsystem::FindBestScored(const AActor* Querier, const FEAISQueryFilter& Filter, TFunctionRef<float(const AActor& Candidate, const FVector& Location)> Score) const
+{
+    const AActor* Best = nullptr;
+    float BestScore = 0.0f;
+    ForEachQueryActor(Querier, Filter, [&](const AActor& Actor, const FVector& Location)
+    {
+        const float CandidateScore = Score(Actor, Location);
+        if (CandidateScore >= 0.0f && (!Best || CandidateScore > BestScore))
+        {
+            BestScore = CandidateScore;
+            Best = &Actor;
+        }
+    });
+    return const_cast<AActor*>(Best);
+}
+
+// ==================== Shared Blackboards ====================
+
+void UEAISSubsystem::SetTeamBlackboardValue(int32 TeamId, FName Key, const FBlackboardValue& Value)
+{
+    GetTeamBlackboard(TeamId)->Set(Key, Value);
+}
+
+bool UEAISSubsystem::GetTeamBlackboardValue(int32 TeamId, FName Key, FBlackboardValue& OutValue) const
+{
+    const TSharedRef<FEAISSharedBlackboard>* Team = TeamBlackboards.Find(TeamId);
+    const FBlackboardValue* Found = Team ? (*Team)->Find(Key) : nullptr;
+    if (Found)
+    {
+        OutValue = *Found;
+    }
+    return Found != nullptr;
+}
+
+void UEAISSubsystem::SetGlobalBlackboardValue(FName Key, const FBlackboardValue& Value)
+{
+    GlobalBlackboard->Set(Key, Value);
+}
+
+bool UEAISSubsystem::GetGlobalBlackboardValue(FName Key, FBlackboardValue& OutValue) const
+{
+    const FBlackboardValue* Found = GlobalBlackboard->Find(Key);
+    if (Found)
+    {
+        OutValue = *Found;
+    }
+    return Found != nullptr;
+}
+
+TSharedRef<FEAISSharedBlackboard> UEAISSubsystem::GetTeamBlackboard(int32 TeamId)
+{
+    if (const TSharedRef<FEAISSharedBlackboard>* Existing = TeamBlackboards.Find(TeamId))
+    {
+        return *Existing;
+    }
+    return TeamBlackboards.Add(TeamId, MakeShared<FEAISSharedBlackboard>());
+}
+
+void UEAISSubsystem::BindSharedBlackboards(UAIComponent* Agent)
+{
+    if (Agent)
+    {
+        Agent->GetInterpreter().BindSharedBlackboards(GetTeamBlackboard(GetCachedTeamId(Agent->GetOwnerPawn())), GlobalBlackboard);
+    }
+}
+
+// ==================== Scoring Queries ====================
+
+namespace
+{
+    /** Frames a job waits for its async traces before unfinished ones count as blocked */
+    constexpr uint64 MaxScoringTraceWaitFrames = 4;
+
+    /** Grid generator steps per axis and direction */
+    constexpr int32 MaxScoringGridSteps = 32;
+}
+
+EAIActionStatus UEAISSubsystem::RequestScoringQuery(UAIComponent* Agent, int32 QueryIndex)
+{
+    if (!Agent || !Agent->GetOwnerPawn())
+    {
+        return EAIActionStatus::Failed;
+    }
+
+    const TSharedPtr<const FEAISCompiledProgram>& Program = Agent->GetInterpreter().GetProgram();
+    if (!Program.IsValid() || !Program->Def.Queries.IsValidIndex(QueryIndex))
+    {
+        return EAIActionStatus::Failed;
+    }
+
+    if (++NextScoringSerial == 0)
+    {
+        ++NextScoringSerial;
+    }
+
+    FEAISScoringRequestState& State = Agent->GetScoringState();
+    State.QueryIndex = QueryIndex;
+    State.Serial = NextScoringSerial;
+    State.Status = EAIActionStatus::Running;
+
+    // One pending job per agent; the latest request wins
+    FEAISScoringJob* Pending = PendingScoringJobs.FindByPredicate([Agent](const FEAISScoringJob& Item) { return Item.Agent.Get() == Agent; });
+    if (!Pending)
+    {
+        Pending = &PendingScoringJobs.AddDefaulted_GetRef();
+        Pending->Agent = Agent;
+    }
+    Pending->Program = Program;
+    Pending->QueryIndex = QueryIndex;
+    Pending->Serial = State.Serial;
+
+    return EAIActionStatus::Running;
+}
+
+void UEAISSubsystem::DispatchScoringQueries()
+{
+    UWorld* World = GetTickableGameObjectWorld();
+    if (PendingScoringJobs.Num() == 0 || !World)
+    {
+        return;
+    }
+
+    // Jobs still waiting for traces stay in ScoringJobs; the new task only sees the jobs added here
+    ScoringTask.Wait();
+    const int32 FirstNewJob = ScoringJobs.Num();
+    const int32 NumToDispatch = FMath::Min(PendingScoringJobs.Num(), MaxScoringQueriesPerFrame);
+
+    for (int32 Index = 0; Index < NumToDispatch; ++Index)
+    {
+        FEAISScoringJob& Job = PendingScoringJobs[Index];
+        UAIComponent* Agent = Job.Agent.Get();
+        const APawn* Pawn = Agent ? Agent->GetOwnerPawn() : nullptr;
+        if (!Pawn || Agent->GetScoringState().Serial != Job.Serial)
+        {
+            continue;
+        }
+
+        Job.Origin = Pawn->GetPawnViewLocation();
+        Job.Forward = Pawn->GetActorForwardVector();
+        Job.DispatchFrame = GFrameCounter;
+        GenerateCandidates(Job, *Pawn);
+
+        // Line of sight is traced async; the results are read when the job is delivered
+        const FEAISQueryDef& Query = Job.Program->Def.Queries[Job.QueryIndex];
+        if (Query.Tests.ContainsByPredicate([](const FEAISQueryTest& Test) { return Test.Type == EEAISQueryTestType::LineOfSight; }))
+        {
+            for (FEAISScoringCandidate& Candidate : Job.Candidates)
+            {
+                FCollisionQueryParams TraceParams(SCENE_QUERY_STAT(EAISScoringQuery), false, Pawn);
+                TraceParams.AddIgnoredActor(Candidate.Actor.Get());
+                Candidate.Trace = World->AsyncLineTraceByChannel(EAsyncTraceType::Test, Job.Origin, Candidate.Location, ECC_Visibility, TraceParams);
+            }
+        }
+
+        ScoringJobs.Add(MoveTemp(Job));
+        ++NumScoringQueries;
+    }
+    PendingScoringJobs.RemoveAt(0, NumToDispatch);
+
+    // Every query dispatched this frame is scored by one worker task
+    if (ScoringJobs.Num() > FirstNewJob)
+    {
+        TArrayView<FEAISScoringJob> NewJobs(ScoringJobs.GetData() + FirstNewJob, ScoringJobs.Num() - FirstNewJob);
+        ScoringTask = UE::Tasks::Launch(UE_SOURCE_LOCATION, [NewJobs]() { ScoreJobs(NewJobs); });
+    }
+}
+
+void UEAISSubsystem::GenerateCandidates(FEAISScoringJob& Job, const AActor& Querier) const
+{
+    const FEAISQueryDef& Query = Job.Program->Def.Queries[Job.QueryIndex];
+    Job.Candidates.Reset();
+
+    if (Query.Generator == EEAISQueryGenerator::Grid)
+    {
+        const FVector Center = Querier.GetActorLocation();
+        const int32 Steps = FMath::Min(FMath::FloorToInt(Query.GridRadius / Query.GridSpacing), MaxScoringGridSteps);
+        const float RadiusSq = FMath::Square(Query.GridRadius);
+        for (int32 X = -Steps; X <= Steps; ++X)
+        {
+            for (int32 Y = -Steps; Y <= Steps; ++Y)
+            {
+                const FVector Offset(X * Query.GridSpacing, Y * Query.GridSpacing, 0.0f);
+                if (Offset.SizeSquared() <= RadiusSq)
+                {
+                    Job.Candidates.AddDefaulted_GetRef().Location = Center + Offset;
+                }
+            }
+        }
+        return;
+    }
+
+    FEAISQueryFilter Filter;
+    Filter.Team = Query.Generator == EEAISQueryGenerator::Allies ? EEAISTeamFilter::Allies : EEAISTeamFilter::Enemies;
+    Filter.Role = Query.Role;
+    ForEachQueryActor(&Querier, Filter, [&Job](const AActor& Actor, const FVector& Location)
+    {
+        FEAISScoringCandidate& Candidate = Job.Candidates.AddDefaulted_GetRef();
+        Candidate.Actor = const_cast<AActor*>(&Actor);
+        Candidate.Location = Location;
+    });
+}
+
+void UEAISSubsystem::ScoreJobs(TArrayView<FEAISScoringJob> Jobs)
+{
+    for (FEAISScoringJob& Job : Jobs)
+    {
+        const FEAISQueryDef& Query = Job.Program->Def.Queries[Job.QueryIndex];
+
+        // One test at a time over all candidates keeps the inner loop branch-free
+        for (const FEAISQueryTest& Test : Query.Tests)
+        {
+            if (Test.Type == EEAISQueryTestType::LineOfSight)
+            {
+                continue;
+            }
+
+            const bool bDistance = Test.Type == EEAISQueryTestType::Distance;
+            const float Range = Test.Max - Test.Min;
+            const float InvRange = FMath::Abs(Range) > KINDA_SMALL_NUMBER ? 1.0f / Range : 0.0f;
+            for (FEAISScoringCandidate& Candidate : Job.Candidates)
+            {
+                const FVector Delta = Candidate.Location - Job.Origin;
+                const float Value = bDistance ? Delta.Size() : FVector::DotProduct(Job.Forward, Delta.GetSafeNormal());
+                Candidate.bRejected |= Test.bFilter && (Value < Test.Min || Value > Test.Max);
+                Candidate.Score += Test.Weight * FMath::Clamp((Value - Test.Min) * InvRange, 0.0f, 1.0f);
+            }
+        }
+    }
+}
+
+void UEAISSubsystem::DeliverScoringResults()
+{
+    UWorld* World = GetTickableGameObjectWorld();
+    if (ScoringJobs.Num() == 0 || !World)
+    {
+        return;
+    }
+
+    ScoringTask.Wait();
+
+    TArray<bool, TInlineAllocator<64>> Visible;
+    ScoringJobs.RemoveAll([this, World, &Visible](FEAISScoringJob& Job)
+    {
+        // Async traces finish a frame or two after they are requested; wait for all of a job's traces
+        Visible.Reset();
+        for (const FEAISScoringCandidate& Candidate : Job.Candidates)
+        {
+            if (!Candidate.Trace.IsValid())
+            {
+                break;
+            }
+
+            FTraceDatum Datum;
+            if (World->QueryTraceData(Candidate.Trace, Datum))
+            {
+                Visible.Add(!Datum.OutHits.ContainsByPredicate([](const FHitResult& Hit) { return Hit.bBlockingHit; }));
+            }
+            else if (World->IsTraceHandleValid(Candidate.Trace, false) && GFrameCounter - Job.DispatchFrame < MaxScoringTraceWaitFrames)
+            {
+                return false;
+            }
+            else
+            {
+                Visible.Add(false);
+            }
+        }
+
+        UAIComponent* Agent = Job.Agent.Get();
+        if (!Agent || Agent->GetScoringState().Serial != Job.Serial || Agent->GetInterpreter().GetProgram() != Job.Program)
+        {
+            return true;
+        }
+
+        const FEAISQueryDef& Query = Job.Program->Def.Queries[Job.QueryIndex];
+        const FEAISScoringCandidate* Best = nullptr;
+        float BestScore = 0.0f;
+        for (int32 Index = 0; Index < Job.Candidates.Num(); ++Index)
+        {
+            FEAISScoringCandidate& Candidate = Job.Candidates[Index];
+            for (const FEAISQueryTest& Test : Query.Tests)
+            {
+                if (Test.Type == EEAISQueryTestType::LineOfSight && Visible.IsValidIndex(Index))
+                {
+                    Candidate.bRejected |= Test.bFilter && !Visible[Index];
+                    Candidate.Score += Visible[Index] ? Test.Weight : 0.0f;
+                }
+            }
+
+            // Actors destroyed since dispatch are skipped
+            const bool bStale = !Candidate.Actor.IsExplicitlyNull() && !Candidate.Actor.IsValid();
+            if (!Candidate.bRejected && !bStale && (!Best || Candidate.Score > BestScore))
+            {
+                Best = &Candidate;
+                BestScore = Candidate.Score;
+            }
+        }
+
+        if (Best && !Query.ResultKey.IsEmpty())
+        {
+            if (AActor* BestActor = Best->Actor.Get())
+            {
+                Agent->SetBlackboardObject(Query.ResultKey, BestActor);
+            }
+            else
+            {
+                Agent->SetBlackboardVector(Query.ResultKey, Best->Location);
+            }
+        }
+
+        Agent->GetScoringState().Status = Best ? EAIActionStatus::Succeeded : EAIActionStatus::Failed;
+        return true;
+    });
+}
+
 FString UEAISSubsystem::GetDebugSummary() const
 {
     FString Summary = FString::Printf(TEXT("EAIS Subsystem Summary:\n"));
@@ -297,6 +1602,26 @@ FString UEAISSubsystem::GetDebugSummary() const
     }
 
     Summary += FString::Printf(TEXT("  Available Behaviors: %d\n"), GetAvailableBehaviors().Num());
+    Summary += FString::Printf(TEXT("  Scheduled Agents: %d (Scheduler %s, Batching %s)\n"), ScheduledAgents.Num(),
+        bUseAgentScheduler ? TEXT("ON") : TEXT("OFF"), bBatchTransitionEvaluation ? TEXT("ON") : TEXT("OFF"));
+
+    int32 NumThrottled = 0;
+    for (const TWeakObjectPtr<UAIComponent>& Agent : ScheduledAgents)
+    {
+        if (Agent.IsValid() && Agent->GetLODTickInterval() > 0.0f)
+        {
+            ++NumThrottled;
+        }
+    }
+    Summary += FString::Printf(TEXT("  Fixed Timestep: %s (%.1f Hz, max %d substeps)\n"),
+        bUseFixedTimestep ? TEXT("ON") : TEXT("OFF"), 1.0f / FixedStepSeconds, MaxSubstepsPerFrame);
+    Summary += FString::Printf(TEXT("  Frame Budget: %.2f ms (%d agents deferred last frame, %d starvation reports)\n"),
+        FrameBudgetMs, NumDeferredAgents, NumStarvationReports);
+    Summary += FString::Printf(TEXT("  Tick LOD: %s (%d agents below full rate)\n"), bLODApplied ? TEXT("ON") : TEXT("OFF"), NumThrottled);
+    Summary += FString::Printf(TEXT("  Move Requests: %d issued, %d coalesced, %d path queries (%s, %d in flight)\n"), NumMoveRequests,
+        NumCoalescedMoveRequests, NumPathQueries, bAsyncPathfinding ? TEXT("async") : TEXT("sync"), PathQueries.Num());
+    Summary += FString::Printf(TEXT("  Query Actors: %d, Scoring Queries: %d dispatched (%d pending, %d in flight)\n"), QueryActors.Num(),
+        NumScoringQueries, PendingScoringJobs.Num(), ScoringJobs.Num());
     
     return Summary;
 }
@@ -315,5 +1640,6 @@ void UEAISSubsystem::RegisterDefaultActions()
     RegisterAction(TEXT("LookAround"), UAIAction_LookAround::StaticClass());
     RegisterAction(TEXT("Log"), UAIAction_Log::StaticClass());
     RegisterAction(TEXT("Execute"), UAIAction_Execute::StaticClass());
+    RegisterAction(TEXT("RunQuery"), UAIAction_RunQuery::StaticClass());
 }
 
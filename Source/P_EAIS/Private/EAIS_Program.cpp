@@ -0,0 +1,486 @@
+/*
+ * @Author: Punal Manalan
+ * @Description: Implementation of FEAISCompiledProgram
+ * @Date: 18/10/2026
+ */
+
+#include "EAIS_Program.h"
+#include "AIAction.h"
+#include "Misc/ConfigCacheIni.h"
+#include "Misc/Paths.h"
+#include "Interfaces/IPluginManager.h"
+
+namespace
+{
+    /**
+     * Entries of Section/Key from the project's game config, then from the plugin's Config/DefaultEAIS.ini.
+     * DefaultEAIS.ini is not part of any engine config hierarchy, so it is read explicitly.
+     */
+    TArray<FString> ReadEAISConfigArray(const TCHAR* Section, const TCHAR* Key)
+    {
+        TArray<FString> Entries;
+        GConfig->GetArray(Section, Key, Entries, GGameIni);
+
+        if (const TSharedPtr<IPlugin> Plugin = IPluginManager::Get().FindPlugin(TEXT("P_EAIS")))
+        {
+            FConfigFile PluginConfig;
+            PluginConfig.Read(FPaths::Combine(Plugin->GetBaseDir(), TEXT("Config"), TEXT("DefaultEAIS.ini")));
+
+            TArray<FString> PluginEntries;
+            PluginConfig.GetArray(Section, Key, PluginEntries);
+            Entries.Append(PluginEntries);
+        }
+        return Entries;
+    }
+}
+
+TSharedRef<const FEAISCompiledProgram> FEAISCompiledProgram::Compile(const FAIBehaviorDef& InDef)
+{
+    static int32 NextSerial = 0;
+
+    TSharedRef<FEAISCompiledProgram> Program = MakeShared<FEAISCompiledProgram>();
+    Program->Def = InDef;
+    Program->Serial = static_cast<uint32>(FPlatformAtomics::InterlockedIncrement(&NextSerial));
+
+    // Project defaults fill keys the behavior does not declare
+    for (const FEAISBlackboardEntry& Entry : EAIS::GetConfigBlackboardDefaults())
+    {
+        if (!Program->Def.Blackboard.ContainsByPredicate([&Entry](const FEAISBlackboardEntry& Item) { return Item.Key == Entry.Key; }))
+        {
+            Program->Def.Blackboard.Add(Entry);
+        }
+    }
+
+    // Blackboard defaults take the first slots so the default layout is stable
+    for (const FEAISBlackboardEntry& Entry : Program->Def.Blackboard)
+    {
+        Program->AddSlot(Entry.Key);
+    }
+
+    for (int32 StateIndex = 0; StateIndex < InDef.States.Num(); ++StateIndex)
+    {
+        Program->StateIndexById.Add(InDef.States[StateIndex].Id, StateIndex);
+        Program->StateNames.Add(FName(*InDef.States[StateIndex].Id));
+    }
+    Program->InitialState = Program->FindState(InDef.InitialState);
+
+    // Query results are written to program slots
+    for (int32 QueryIndex = 0; QueryIndex < InDef.Queries.Num(); ++QueryIndex)
+    {
+        Program->QueryIndexByName.Add(InDef.Queries[QueryIndex].Name, QueryIndex);
+        Program->AddSlot(InDef.Queries[QueryIndex].ResultKey);
+    }
+
+    // Intern action targets, bind "$Key" targets to slots and prebuild typed and forwarded params once for every agent
+    for (FAIState& State : Program->Def.States)
+    {
+        Program->PrepareActions(State.OnEnter);
+        Program->PrepareActions(State.OnTick);
+        Program->PrepareActions(State.OnExit);
+    }
+
+    Program->States.SetNum(InDef.States.Num());
+    for (int32 StateIndex = 0; StateIndex < InDef.States.Num(); ++StateIndex)
+    {
+        const FAIState& State = InDef.States[StateIndex];
+        FEAISCompiledState& Compiled = Program->States[StateIndex];
+        Compiled.Transitions.Reserve(State.Transitions.Num());
+
+        for (int32 Index = 0; Index < State.Transitions.Num(); ++Index)
+        {
+            const FAITransition& Trans = State.Transitions[Index];
+
+            FEAISCompiledTransition Item;
+            Item.TargetState = Program->FindState(Trans.To);
+            Item.Condition = Program->CompileCondition(Trans.Condition);
+            Item.SourceIndex = Index;
+            Compiled.Transitions.Add(Item);
+        }
+
+        // Sorted by priority, deterministic tie-break by original order
+        Compiled.Transitions.Sort([&State](const FEAISCompiledTransition& A, const FEAISCompiledTransition& B)
+        {
+            const int32 PriorityA = State.Transitions[A.SourceIndex].Priority;
+            const int32 PriorityB = State.Transitions[B.SourceIndex].Priority;
+            if (PriorityA != PriorityB)
+            {
+                return PriorityA > PriorityB;
+            }
+            return A.SourceIndex < B.SourceIndex;
+        });
+
+        // Event dispatch table: event-gated transitions are only considered when their event arrives
+        for (int32 Rank = 0; Rank < Compiled.Transitions.Num(); ++Rank)
+        {
+            const int32 EventId = Program->GetRequiredEvent(Compiled.Transitions[Rank].Condition);
+            if (EventId == INDEX_NONE)
+            {
+                Compiled.NonEventRanks.Add(Rank);
+            }
+            else
+            {
+                Compiled.EventRanks.FindOrAdd(EventId).Add(Rank);
+            }
+        }
+    }
+
+    // Input mappings resolve to event ids once, so routed input never looks up event names
+    for (const FEAISInputMapping& Mapping : EAIS::GetConfigInputMappings())
+    {
+        Program->InputEventIds.Add(Mapping.InputAction, Program->AddEvent(Mapping.EventName));
+    }
+
+    // Every slot is known now
+    Program->BuildDefaultImage();
+
+    return Program;
+}
+
+void FEAISCompiledProgram::BuildDefaultImage()
+{
+    DefaultImage.Reset();
+    DefaultImage.SetNum(NumSlots());
+    DefaultImageSet.Init(false, NumSlots());
+    SharedDefaults.Reset();
+
+    for (const FEAISBlackboardEntry& Entry : Def.Blackboard)
+    {
+        const int32 Slot = FindSlot(Entry.Key);
+        if (Slot == INDEX_NONE)
+        {
+            continue;
+        }
+
+        // Shared keys also get an image default: it is used while their scope is unbound
+        const FBlackboardValue Value = EAIS::MakeDefaultValue(Entry.Value.Type, Entry.Value.RawValue);
+        DefaultImage[Slot] = Value;
+        DefaultImageSet[Slot] = true;
+        if (GetSlotScope(Slot) == EEAISBlackboardScope::Agent)
+        {
+            continue;
+        }
+
+        FEAISSharedDefault& Shared = SharedDefaults.AddDefaulted_GetRef();
+        Shared.Scope = GetSlotScope(Slot);
+        Shared.Key = GetSlotSharedKey(Slot);
+        Shared.Value = Value;
+    }
+}
+
+int32 FEAISCompiledProgram::FindState(const FString& StateId) const
+{
+    const int32* Found = StateIndexById.Find(StateId);
+    return Found ? *Found : INDEX_NONE;
+}
+
+int32 FEAISCompiledProgram::FindSlot(const FString& Key) const
+{
+    const int32* Found = SlotByKey.Find(Key);
+    return Found ? *Found : INDEX_NONE;
+}
+
+int32 FEAISCompiledProgram::FindEvent(const FString& EventName) const
+{
+    const int32* Found = EventIdByName.Find(EventName);
+    return Found ? *Found : INDEX_NONE;
+}
+
+int32 FEAISCompiledProgram::FindInputEvent(FName InputAction) const
+{
+    const int32* Found = InputEventIds.Find(InputAction);
+    return Found ? *Found : INDEX_NONE;
+}
+
+int32 FEAISCompiledProgram::FindQuery(const FString& QueryName) const
+{
+    const int32* Found = QueryIndexByName.Find(QueryName);
+    return Found ? *Found : INDEX_NONE;
+}
+
+int32 FEAISCompiledProgram::AddEvent(const FString& EventName)
+{
+    if (const int32* Existing = EventIdByName.Find(EventName))
+    {
+        return *Existing;
+    }
+
+    const int32 EventId = EventNames.Add(EventName);
+    EventIdByName.Add(EventName, EventId);
+    return EventId;
+}
+
+int32 FEAISCompiledProgram::GetRequiredEvent(int32 ConditionIndex) const
+{
+    const FEAISCompiledCondition& Condition = Conditions[ConditionIndex];
+    if (Condition.Type == EAIConditionType::Event)
+    {
+        return Condition.EventId;
+    }
+
+    if (Condition.Type == EAIConditionType::And)
+    {
+        for (int32 Child : Condition.Children)
+        {
+            if (Conditions[Child].Type == EAIConditionType::Event)
+            {
+                return Conditions[Child].EventId;
+            }
+        }
+    }
+
+    return INDEX_NONE;
+}
+
+int32 FEAISCompiledProgram::AddSlot(const FString& Key)
+{
+    if (Key.IsEmpty())
+    {
+        return INDEX_NONE;
+    }
+
+    if (const int32* Existing = SlotByKey.Find(Key))
+    {
+        return *Existing;
+    }
+
+    const int32 Slot = SlotKeys.Add(Key);
+    SlotByKey.Add(Key, Slot);
+
+    FName SharedKey;
+    const EEAISBlackboardScope Scope = EAIS::ParseBlackboardScope(Key, SharedKey);
+    SlotScopes.Add(Scope);
+    SlotSharedKeys.Add(SharedKey);
+    bHasSharedSlots |= Scope != EEAISBlackboardScope::Agent;
+    return Slot;
+}
+
+void FEAISCompiledProgram::PrepareActions(TArray<FAIActionEntry>& Actions)
+{
+    for (FAIActionEntry& Entry : Actions)
+    {
+        FAIActionParams& Params = Entry.Params;
+        if (Params.Target.Len() > 1 && Params.Target[0] == EAIS::BlackboardBindingPrefix)
+        {
+            // Bound targets read one slot at runtime; the slot exists even if nothing has written the key yet
+            const FString Key = Params.Target.RightChop(1);
+            Params.TargetSlot = AddSlot(Key);
+            Params.TargetName = FName(*Key);
+        }
+        else
+        {
+            Params.TargetName = FName(*Params.Target);
+        }
+
+        if (Entry.Action == TEXT("Execute"))
+        {
+            Params.InnerParams = MakeShared<const FAIActionParams>(EAIS::MakeExecuteInnerParams(Params));
+        }
+
+        // Typed params by the registered action's schema; actions registered under another class later parse on demand
+        Params.ParamBlock = UAIAction::BuildParamBlock(UAIAction::FindActionClass(Entry.Action), Params);
+    }
+}
+
+int32 FEAISCompiledProgram::CompileCondition(const FAICondition& Condition)
+{
+    FEAISCompiledCondition Compiled;
+    Compiled.Type = Condition.Type;
+    Compiled.Operator = Condition.Operator;
+    Compiled.Name = Condition.Name;
+    Compiled.Seconds = Condition.Seconds;
+
+    switch (Condition.Type)
+    {
+    case EAIConditionType::Blackboard:
+        Compiled.Slot = AddSlot(Condition.Name);
+        // Parse the compare value for every type; the key's runtime type picks the field
+        Compiled.CompareValue.RawValue = Condition.Value;
+        for (EBlackboardValueType ValueType : { EBlackboardValueType::Bool, EBlackboardValueType::Int, EBlackboardValueType::Float,
+                                                EBlackboardValueType::String, EBlackboardValueType::Vector })
+        {
+            Compiled.CompareValue.Type = ValueType;
+            Compiled.CompareValue.FromString(Condition.Value);
+        }
+        Compiled.CompareValue.Type = EBlackboardValueType::String;
+        break;
+
+    case EAIConditionType::Distance:
+        Compiled.Slot = AddSlot(Condition.Target.IsEmpty() ? Condition.Name : Condition.Target);
+        Compiled.CompareDistance = FCString::Atof(*Condition.Value);
+        break;
+
+    case EAIConditionType::Event:
+        Compiled.EventId = AddEvent(Condition.Name);
+        break;
+
+    case EAIConditionType::Action:
+        Compiled.StatusMask = EAIS::ParseActionStatusMask(Condition.Value);
+        break;
+
+    default:
+        break;
+    }
+
+    for (const FAICondition& Sub : Condition.SubConditions)
+    {
+        Compiled.Children.Add(CompileCondition(Sub));
+    }
+
+    return Conditions.Add(MoveTemp(Compiled));
+}
+
+FBlackboardValue EAIS::MakeDefaultValue(EBlackboardValueType Type, const FString& RawValue)
+{
+    FBlackboardValue Value;
+    Value.Type = Type;
+    Value.RawValue = RawValue;
+
+    switch (Type)
+    {
+    case EBlackboardValueType::Bool:
+    case EBlackboardValueType::Int:
+    case EBlackboardValueType::Float:
+    case EBlackboardValueType::Vector:
+        Value.FromString(RawValue);
+        break;
+    case EBlackboardValueType::Object:
+        // Objects cannot be authored as defaults; the key keeps its type with a null object (RawValue keeps the text)
+        break;
+    default:
+        Value.Type = EBlackboardValueType::String;
+        Value.StringValue = RawValue;
+        break;
+    }
+    return Value;
+}
+
+const TArray<FEAISBlackboardEntry>& EAIS::GetConfigBlackboardDefaults()
+{
+    static TArray<FEAISBlackboardEntry> Defaults;
+    static bool bLoaded = false;
+    if (bLoaded || !GConfig)
+    {
+        return Defaults;
+    }
+    bLoaded = true;
+
+    // Entry format: (Key="HasBall", Type="Bool", Value="false"); project entries come first and win
+    for (const FString& Line : ReadEAISConfigArray(TEXT("EAIS.Blackboard"), TEXT("DefaultValue")))
+    {
+        FString Key;
+        FString TypeName;
+        FString RawValue;
+        if (!FParse::Value(*Line, TEXT("Key="), Key) || Key.IsEmpty())
+        {
+            UE_LOG(LogTemp, Warning, TEXT("EAIS: Ignoring [EAIS.Blackboard] entry without a key: %s"), *Line);
+            continue;
+        }
+        if (Defaults.ContainsByPredicate([&Key](const FEAISBlackboardEntry& Item) { return Item.Key == Key; }))
+        {
+            continue;
+        }
+        FParse::Value(*Line, TEXT("Type="), TypeName);
+        FParse::Value(*Line, TEXT("Value="), RawValue);
+
+        const int64 TypeValue = StaticEnum<EBlackboardValueType>()->GetValueByNameString(TypeName);
+
+        FEAISBlackboardEntry& Entry = Defaults.AddDefaulted_GetRef();
+        Entry.Key = Key;
+        Entry.Value.Type = TypeValue != INDEX_NONE ? static_cast<EBlackboardValueType>(TypeValue) : EBlackboardValueType::String;
+        Entry.Value.RawValue = RawValue;
+    }
+    return Defaults;
+}
+
+const TArray<FEAISInputMapping>& EAIS::GetConfigInputMappings()
+{
+    static TArray<FEAISInputMapping> Mappings;
+    static bool bLoaded = false;
+    if (bLoaded || !GConfig)
+    {
+        return Mappings;
+    }
+    bLoaded = true;
+
+    // Entry format: (InputAction="Jump", EventName="JumpCommand"); project entries come first and win
+    for (const FString& Line : ReadEAISConfigArray(TEXT("EAIS.InputMapping"), TEXT("InputToEvent")))
+    {
+        FString InputAction;
+        FString EventName;
+        if (!FParse::Value(*Line, TEXT("InputAction="), InputAction) || !FParse::Value(*Line, TEXT("EventName="), EventName)
+            || InputAction.IsEmpty() || EventName.IsEmpty())
+        {
+            UE_LOG(LogTemp, Warning, TEXT("EAIS: Ignoring incomplete [EAIS.InputMapping] entry: %s"), *Line);
+            continue;
+        }
+
+        const FName ActionName(*InputAction);
+        if (Mappings.ContainsByPredicate([ActionName](const FEAISInputMapping& Item) { return Item.InputAction == ActionName; }))
+        {
+            continue;
+        }
+
+        FEAISInputMapping& Mapping = Mappings.AddDefaulted_GetRef();
+        Mapping.InputAction = ActionName;
+        Mapping.EventName = EventName;
+    }
+    return Mappings;
+}
+
+EEAISBlackboardScope EAIS::ParseBlackboardScope(const FString& Key, FName& OutSharedKey)
+{
+    static const FString TeamPrefix(TEXT("team."));
+    static const FString GlobalPrefix(TEXT("global."));
+
+    if (Key.Len() > TeamPrefix.Len() && Key.StartsWith(TeamPrefix, ESearchCase::IgnoreCase))
+    {
+        OutSharedKey = FName(*Key.RightChop(TeamPrefix.Len()));
+        return EEAISBlackboardScope::Team;
+    }
+    if (Key.Len() > GlobalPrefix.Len() && Key.StartsWith(GlobalPrefix, ESearchCase::IgnoreCase))
+    {
+        OutSharedKey = FName(*Key.RightChop(GlobalPrefix.Len()));
+        return EEAISBlackboardScope::Global;
+    }
+
+    OutSharedKey = NAME_None;
+    return EEAISBlackboardScope::Agent;
+}
+
+uint8 EAIS::ParseActionStatusMask(const FString& Value)
+{
+    if (Value.IsEmpty() || Value.Equals(TEXT("Succeeded"), ESearchCase::IgnoreCase) || Value.Equals(TEXT("Success"), ESearchCase::IgnoreCase))
+    {
+        return ActionStatusBit(EAIActionStatus::Succeeded);
+    }
+    if (Value.Equals(TEXT("Failed"), ESearchCase::IgnoreCase))
+    {
+        return ActionStatusBit(EAIActionStatus::Failed);
+    }
+    if (Value.Equals(TEXT("Running"), ESearchCase::IgnoreCase))
+    {
+        return ActionStatusBit(EAIActionStatus::Running);
+    }
+    if (Value.Equals(TEXT("Completed"), ESearchCase::IgnoreCase) || Value.Equals(TEXT("Finished"), ESearchCase::IgnoreCase))
+    {
+        return ActionStatusBit(EAIActionStatus::Succeeded) | ActionStatusBit(EAIActionStatus::Failed);
+    }
+
+    UE_LOG(LogTemp, Warning, TEXT("FEAISCompiledProgram: Unknown action status '%s', expecting Succeeded"), *Value);
+    return ActionStatusBit(EAIActionStatus::Succeeded);
+}
+
+FAIActionParams EAIS::MakeExecuteInnerParams(const FAIActionParams& Params)
+{
+    FAIActionParams InnerParams;
+
+    // The parser flattens nested params into ExtraParams; the callee sees all of them
+    InnerParams.Target = Params.ExtraParams.FindRef(TEXT("target"));
+    InnerParams.TargetName = FName(*InnerParams.Target);
+    if (const FString* Power = Params.ExtraParams.Find(TEXT("power")))
+    {
+        InnerParams.Power = FCString::Atof(**Power);
+    }
+    InnerParams.ExtraParams = Params.ExtraParams;
+    return InnerParams;
+}
@@ -6,6 +6,17 @@
 
 #include "EAIS_Types.h"
 
+const FEAISParamValue* FAIActionParams::GetParam(const UClass* ActionClass, int32 Index) const
+{
+    if (!ParamBlock.IsValid() || ParamBlock->SchemaOwner.Get() != ActionClass || !ParamBlock->Values.IsValidIndex(Index))
+    {
+        return nullptr;
+    }
+
+    const FEAISParamValue& Param = ParamBlock->Values[Index];
+    return Param.bIsSet ? &Param : nullptr;
+}
+
 FString FBlackboardValue::ToString() const
 {
     switch (Type)
@@ -52,6 +63,25 @@ void FBlackboardValue::FromString(const FString& Value)
     }
 }
 
+bool FBlackboardValue::Identical(const FBlackboardValue& Other) const
+{
+    if (Type != Other.Type)
+    {
+        return false;
+    }
+
+    switch (Type)
+    {
+    case EBlackboardValueType::Bool:   return BoolValue == Other.BoolValue;
+    case EBlackboardValueType::Int:    return IntValue == Other.IntValue;
+    case EBlackboardValueType::Float:  return FloatValue == Other.FloatValue;
+    case EBlackboardValueType::String: return StringValue.Equals(Other.StringValue, ESearchCase::CaseSensitive);
+    case EBlackboardValueType::Vector: return VectorValue == Other.VectorValue;
+    case EBlackboardValueType::Object: return ObjectValue == Other.ObjectValue;
+    default:                           return false;
+    }
+}
+
 bool FBlackboardValue::Compare(const FBlackboardValue& Other, EAIConditionOperator Op) const
 {
     // For bool and object, only == and != make sense
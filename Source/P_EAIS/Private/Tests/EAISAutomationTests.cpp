@@ -11,6 +11,15 @@
 #include "AIAction.h"
 #include "EAIS_Types.h"
 #include "EAIS_ProfileUtils.h"
+#include "EAIS_Program.h"
+#include "EAISSubsystem.h"
+#include "EAISSettings.h"
+#include "AIComponent.h"
+#include "EAISTestActions.h"
+#include "EAISJsonEditorParser.h"
+#include "Engine/Engine.h"
+#include "Engine/GameInstance.h"
+#include "Engine/World.h"
 #include "Misc/AutomationTest.h"
 
 #if WITH_DEV_AUTOMATION_TESTS
@@ -418,4 +427,1226 @@ bool FEAISCompositeConditionTest::RunTest(const FString &Parameters)
     return true;
 }
 
+// ==============================================================================
+// EAIS.Core.BatchedTransitions
+// ==============================================================================
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FEAISBatchedTransitionTest, "EAIS.Core.BatchedTransitions",
+                                 EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FEAISBatchedTransitionTest::RunTest(const FString &Parameters)
+{
+    auto MakeTransition = [](const TCHAR *To, int32 Priority, EAIConditionType Type, const TCHAR *Key,
+                             EAIConditionOperator Op, const TCHAR *Value, float Seconds)
+    {
+        FAITransition Trans;
+        Trans.To = To;
+        Trans.Priority = Priority;
+        Trans.Condition.Type = Type;
+        Trans.Condition.Name = Key;
+        Trans.Condition.Operator = Op;
+        Trans.Condition.Value = Value;
+        Trans.Condition.Seconds = Seconds;
+        return Trans;
+    };
+
+    FAIBehaviorDef Def;
+    Def.Name = TEXT("BatchTest");
+    Def.InitialState = TEXT("Idle");
+    Def.bIsValid = true;
+
+    FAIState Idle;
+    Idle.Id = TEXT("Idle");
+    Idle.Transitions.Add(MakeTransition(TEXT("Wander"), 10, EAIConditionType::Timer, TEXT(""), EAIConditionOperator::GreaterOrEqual, TEXT(""), 2.0f));
+    Idle.Transitions.Add(MakeTransition(TEXT("Rest"), 100, EAIConditionType::Blackboard, TEXT("Stamina"), EAIConditionOperator::LessThan, TEXT("0.2"), 0.0f));
+    Idle.Transitions.Add(MakeTransition(TEXT("Attack"), 50, EAIConditionType::Blackboard, TEXT("HasBall"), EAIConditionOperator::Equal, TEXT("true"), 0.0f));
+    Idle.Transitions.Add(MakeTransition(TEXT("Flee"), 50, EAIConditionType::Event, TEXT("Danger"), EAIConditionOperator::Equal, TEXT(""), 0.0f));
+    Def.States.Add(Idle);
+
+    for (const TCHAR *Id : {TEXT("Wander"), TEXT("Rest"), TEXT("Attack"), TEXT("Flee")})
+    {
+        FAIState State;
+        State.Id = Id;
+        Def.States.Add(State);
+    }
+
+    const TSharedPtr<const FEAISCompiledProgram> Program = FEAISCompiledProgram::Compile(Def);
+
+    // Agents sharing one program with different blackboards and elapsed times
+    constexpr int32 NumAgents = 8;
+    TArray<FAIInterpreter> Agents;
+    Agents.SetNum(NumAgents);
+    TArray<FAIInterpreter *> Batch;
+    for (int32 Index = 0; Index < NumAgents; ++Index)
+    {
+        FAIInterpreter &Agent = Agents[Index];
+        TestTrue(TEXT("Program should load"), Agent.LoadFromProgram(Program));
+        Agent.Reset();
+        Agent.SetBlackboardFloat(TEXT("Stamina"), Index * 0.1f);
+        if (Index % 2 == 0)
+        {
+            Agent.SetBlackboardBool(TEXT("HasBall"), Index % 4 == 0);
+        }
+        if (Index == 7)
+        {
+            Agent.EnqueueEvent(TEXT("Danger"), FAIEventPayload());
+        }
+        Agent.BeginTick(Index < 4 ? 1.0f : 3.0f);
+        Batch.Add(&Agent);
+    }
+
+    TArray<int32> Ranks;
+    Ranks.SetNumUninitialized(NumAgents);
+    FEAISTransitionBatchScratch Scratch;
+    FAIInterpreter::SelectTransitionsBatch(Batch, Ranks, Scratch);
+
+    for (int32 Index = 0; Index < NumAgents; ++Index)
+    {
+        TestEqual(FString::Printf(TEXT("Agent %d batched rank should match scalar selection"), Index), Ranks[Index], Agents[Index].SelectTransition());
+    }
+
+    // Priority 100 (Rest) wins for low stamina; event-driven Flee is picked up for agent 7
+    TestEqual(TEXT("Agent 0 should pick Rest"), Ranks[0], 0);
+    TestEqual(TEXT("Agent 1 should pick Rest"), Ranks[1], 0);
+    TestEqual(TEXT("Agent 2 has no passing transition"), Ranks[2], INDEX_NONE);
+    TestEqual(TEXT("Agent 4 should pick Attack"), Ranks[4], 1);
+    TestEqual(TEXT("Agent 5 should pick Wander"), Ranks[5], 3);
+    TestEqual(TEXT("Agent 7 should pick Flee"), Ranks[7], 2);
+
+    Agents[4].EndTick(Ranks[4]);
+    TestEqual(TEXT("Agent 4 should be in Attack"), Agents[4].GetCurrentStateId(), FString(TEXT("Attack")));
+
+    return true;
+}
+
+// ==============================================================================
+// EAIS.Core.TransitionChaining
+// ==============================================================================
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FEAISTransitionChainingTest, "EAIS.Core.TransitionChaining",
+                                 EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FEAISTransitionChainingTest::RunTest(const FString &Parameters)
+{
+    // Idle -> Chase -> Shoot -> Celebrate -> Idle, all gated on the same key
+    FAIBehaviorDef Def;
+    Def.Name = TEXT("ChainTest");
+    Def.InitialState = TEXT("Idle");
+    Def.bIsValid = true;
+
+    const TCHAR *StateIds[] = {TEXT("Idle"), TEXT("Chase"), TEXT("Shoot"), TEXT("Celebrate")};
+    for (int32 Index = 0; Index < 4; ++Index)
+    {
+        FAITransition Trans;
+        Trans.To = StateIds[(Index + 1) % 4];
+        Trans.Condition.Type = EAIConditionType::Blackboard;
+        Trans.Condition.Name = TEXT("Go");
+        Trans.Condition.Value = TEXT("true");
+
+        FAIState State;
+        State.Id = StateIds[Index];
+        State.Transitions.Add(Trans);
+        Def.States.Add(State);
+    }
+
+    // Default: one transition per tick
+    FAIInterpreter Single;
+    Single.LoadFromDef(Def);
+    Single.Reset();
+    Single.SetBlackboardBool(TEXT("Go"), true);
+    Single.Tick(0.1f);
+    TestEqual(TEXT("Single transition per tick by default"), Single.GetCurrentStateId(), FString(TEXT("Chase")));
+
+    // Chained: stops before looping back into Idle
+    Def.MaxTransitionsPerTick = 8;
+    FAIInterpreter Chained;
+    Chained.LoadFromDef(Def);
+    Chained.Reset();
+    Chained.SetBlackboardBool(TEXT("Go"), true);
+    Chained.Tick(0.1f);
+    TestEqual(TEXT("Chain should run to Celebrate and stop before revisiting Idle"), Chained.GetCurrentStateId(), FString(TEXT("Celebrate")));
+
+    // Limit is respected
+    Def.MaxTransitionsPerTick = 2;
+    FAIInterpreter Limited;
+    Limited.LoadFromDef(Def);
+    Limited.Reset();
+    Limited.SetBlackboardBool(TEXT("Go"), true);
+    Limited.Tick(0.1f);
+    TestEqual(TEXT("Chain should stop at the limit"), Limited.GetCurrentStateId(), FString(TEXT("Shoot")));
+
+    return true;
+}
+
+// ==============================================================================
+// EAIS.Core.TargetBinding
+// ==============================================================================
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FEAISTargetBindingTest, "EAIS.Core.TargetBinding",
+                                 EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FEAISTargetBindingTest::RunTest(const FString &Parameters)
+{
+    FAIActionEntry Bound;
+    Bound.Action = TEXT("MoveTo");
+    Bound.Params.Target = TEXT("$Goal");
+
+    FAIActionEntry Named;
+    Named.Action = TEXT("MoveTo");
+    Named.Params.Target = TEXT("Goal");
+
+    FAIState State;
+    State.Id = TEXT("Idle");
+    State.OnTick.Add(Bound);
+    State.OnTick.Add(Named);
+
+    FAIBehaviorDef Def;
+    Def.Name = TEXT("BindingTest");
+    Def.InitialState = TEXT("Idle");
+    Def.bIsValid = true;
+    Def.States.Add(State);
+
+    TSharedRef<const FEAISCompiledProgram> Program = FEAISCompiledProgram::Compile(Def);
+    const FAIActionParams &BoundParams = Program->Def.States[0].OnTick[0].Params;
+    const FAIActionParams &NamedParams = Program->Def.States[0].OnTick[1].Params;
+    TestEqual(TEXT("$Goal should bind to the Goal slot"), BoundParams.TargetSlot, Program->FindSlot(TEXT("Goal")));
+    TestTrue(TEXT("$Goal should be bound"), BoundParams.IsTargetBound());
+    TestFalse(TEXT("Plain names should stay unbound"), NamedParams.IsTargetBound());
+
+    FAIInterpreter Interpreter;
+    Interpreter.LoadFromProgram(Program);
+    Interpreter.Reset();
+
+    FVector Location = FVector(1.0f);
+    TestFalse(TEXT("Unset key should not resolve"), Interpreter.GetBlackboardLocation(BoundParams.TargetSlot, Location));
+
+    // A zero vector is a real location, not a missing key
+    Interpreter.SetBlackboardVector(TEXT("Goal"), FVector::ZeroVector);
+    TestTrue(TEXT("Set key should resolve"), Interpreter.GetBlackboardLocation(BoundParams.TargetSlot, Location));
+    TestEqual(TEXT("Resolved location"), Location, FVector::ZeroVector);
+
+    return true;
+}
+
+// ==============================================================================
+// EAIS.Core.SharedBlackboard
+// ==============================================================================
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FEAISSharedBlackboardTest, "EAIS.Core.SharedBlackboard",
+                                 EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FEAISSharedBlackboardTest::RunTest(const FString &Parameters)
+{
+    // Idle -> Attack when the team blackboard says we have the ball
+    FAITransition Trans;
+    Trans.To = TEXT("Attack");
+    Trans.Condition.Type = EAIConditionType::Blackboard;
+    Trans.Condition.Name = TEXT("team.HasBall");
+    Trans.Condition.Value = TEXT("true");
+
+    FAIState Idle;
+    Idle.Id = TEXT("Idle");
+    Idle.Transitions.Add(Trans);
+
+    FAIState Attack;
+    Attack.Id = TEXT("Attack");
+
+    FAIBehaviorDef Def;
+    Def.Name = TEXT("SharedTest");
+    Def.InitialState = TEXT("Idle");
+    Def.bIsValid = true;
+    Def.States.Add(Idle);
+    Def.States.Add(Attack);
+
+    FEAISBlackboardEntry Default;
+    Default.Key = TEXT("team.HasBall");
+    Default.Value.Type = EBlackboardValueType::Bool;
+    Default.Value.RawValue = TEXT("false");
+    Def.Blackboard.Add(Default);
+
+    TSharedRef<const FEAISCompiledProgram> Program = FEAISCompiledProgram::Compile(Def);
+    TSharedPtr<FEAISSharedBlackboard> Team = MakeShared<FEAISSharedBlackboard>();
+    TSharedPtr<FEAISSharedBlackboard> Global = MakeShared<FEAISSharedBlackboard>();
+
+    FAIInterpreter First;
+    FAIInterpreter Second;
+    for (FAIInterpreter *Interpreter : {&First, &Second})
+    {
+        Interpreter->LoadFromProgram(Program);
+        Interpreter->BindSharedBlackboards(Team, Global);
+        Interpreter->Reset();
+    }
+
+    const FBlackboardValue *Seeded = Team->Find(TEXT("HasBall"));
+    TestTrue(TEXT("Shared default should be seeded once"), Seeded && !Seeded->BoolValue);
+
+    // One write, seen by both agents
+    First.SetBlackboardBool(TEXT("team.HasBall"), true);
+    TestTrue(TEXT("Second agent should read the team value"), Second.GetBlackboardBool(TEXT("team.HasBall")));
+
+    // Re-binding must not reset live shared values
+    Second.BindSharedBlackboards(Team, Global);
+    TestTrue(TEXT("Live shared value should survive re-binding"), First.GetBlackboardBool(TEXT("team.HasBall")));
+
+    Second.Tick(0.1f);
+    TestEqual(TEXT("Condition should read the team blackboard"), Second.GetCurrentStateId(), FString(TEXT("Attack")));
+
+    // Typed getters see shared keys the program does not reference
+    Global->Set(TEXT("BallPos"), FBlackboardValue(FVector(1.0f, 2.0f, 3.0f)));
+    TestEqual(TEXT("Typed getter should read unreferenced shared keys"), First.GetBlackboardVector(TEXT("global.BallPos")), FVector(1.0f, 2.0f, 3.0f));
+
+    // Without bound shared blackboards, team/global keys behave as agent keys
+    FAIInterpreter Standalone;
+    Standalone.LoadFromProgram(Program);
+    Standalone.Reset();
+    TestFalse(TEXT("Unbound shared key should read its default"), Standalone.GetBlackboardBool(TEXT("team.HasBall")));
+    Standalone.SetBlackboardBool(TEXT("team.HasBall"), true);
+    Standalone.SetBlackboardFloat(TEXT("global.Score"), 2.0f);
+    TestTrue(TEXT("Unbound shared write should be kept"), Standalone.GetBlackboardBool(TEXT("team.HasBall")));
+    TestEqual(TEXT("Unbound unreferenced shared write should be kept"), Standalone.GetBlackboardFloat(TEXT("global.Score")), 2.0f);
+
+    return true;
+}
+
+// ==============================================================================
+// EAIS.Core.BlackboardObservers
+// ==============================================================================
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FEAISBlackboardObserversTest, "EAIS.Core.BlackboardObservers",
+                                 EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FEAISBlackboardObserversTest::RunTest(const FString &Parameters)
+{
+    FAIInterpreter Interpreter;
+
+    int32 NumCalls = 0;
+    float LastValue = 0.0f;
+    const FDelegateHandle Handle = Interpreter.ObserveBlackboardKey(TEXT("Health"), FOnEAISBlackboardChanged::FDelegate::CreateLambda(
+        [&NumCalls, &LastValue](const FString &Key, const FBlackboardValue &Value)
+        {
+            ++NumCalls;
+            LastValue = Value.FloatValue;
+        }));
+
+    // Several writes in one tick are reported once, with the final value
+    Interpreter.SetBlackboardFloat(TEXT("Health"), 50.0f);
+    Interpreter.SetBlackboardFloat(TEXT("Health"), 40.0f);
+    Interpreter.DispatchBlackboardChanges();
+    TestEqual(TEXT("Writes should be coalesced"), NumCalls, 1);
+    TestEqual(TEXT("Observer should see the last value"), LastValue, 40.0f);
+
+    // Writing the same value, or changing and restoring it, is not a change
+    Interpreter.SetBlackboardFloat(TEXT("Health"), 10.0f);
+    Interpreter.SetBlackboardFloat(TEXT("Health"), 40.0f);
+    Interpreter.DispatchBlackboardChanges();
+    TestEqual(TEXT("Unchanged value should not be reported"), NumCalls, 1);
+
+    // Other keys do not notify
+    Interpreter.SetBlackboardFloat(TEXT("Stamina"), 1.0f);
+    Interpreter.DispatchBlackboardChanges();
+    TestEqual(TEXT("Unobserved key should not be reported"), NumCalls, 1);
+
+    Interpreter.RemoveBlackboardObserver(TEXT("Health"), Handle);
+    Interpreter.SetBlackboardFloat(TEXT("Health"), 5.0f);
+    Interpreter.DispatchBlackboardChanges();
+    TestEqual(TEXT("Removed observer should not be called"), NumCalls, 1);
+
+    return true;
+}
+
+// ==============================================================================
+// EAIS.Core.BlackboardKeyHandles
+// ==============================================================================
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FEAISBlackboardKeyHandlesTest, "EAIS.Core.BlackboardKeyHandles",
+                                 EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FEAISBlackboardKeyHandlesTest::RunTest(const FString &Parameters)
+{
+    FAIState Idle;
+    Idle.Id = TEXT("Idle");
+
+    FAIBehaviorDef Def;
+    Def.Name = TEXT("HandleTest");
+    Def.InitialState = TEXT("Idle");
+    Def.bIsValid = true;
+    Def.States.Add(Idle);
+
+    FEAISBlackboardEntry Stamina;
+    Stamina.Key = TEXT("Stamina");
+    Stamina.Value.Type = EBlackboardValueType::Float;
+    Stamina.Value.RawValue = TEXT("1.0");
+    Def.Blackboard.Add(Stamina);
+
+    FEAISBlackboardEntry Ball;
+    Ball.Key = TEXT("Ball");
+    Ball.Value.Type = EBlackboardValueType::Object;
+    Def.Blackboard.Add(Ball);
+
+    TSharedRef<const FEAISCompiledProgram> Program = FEAISCompiledProgram::Compile(Def);
+    FAIInterpreter First;
+    FAIInterpreter Second;
+    First.LoadFromProgram(Program);
+    Second.LoadFromProgram(Program);
+
+    FEAISBlackboardKeyHandle Handle(TEXT("Stamina"), EBlackboardValueType::Float);
+    TestTrue(TEXT("Declared key should resolve"), First.ResolveKeyHandle(Handle));
+    TestEqual(TEXT("Handle should read the default"), First.GetBlackboardFloat(Handle), 1.0f);
+
+    // One resolve serves every agent on the program
+    Second.SetBlackboardFloat(Handle, 0.25f);
+    TestEqual(TEXT("Handle write should be visible by key"), Second.GetBlackboardFloat(TEXT("Stamina")), 0.25f);
+    TestEqual(TEXT("Other agent keeps its value"), First.GetBlackboardFloat(Handle), 1.0f);
+
+    FEAISBlackboardKeyHandle WrongType(TEXT("Stamina"), EBlackboardValueType::Bool);
+    TestFalse(TEXT("Type mismatch should not resolve"), First.ResolveKeyHandle(WrongType));
+
+    // Writing through the rejected handle must not retype the declared key
+    First.SetBlackboardBool(WrongType, true);
+    FBlackboardValue Declared;
+    TestTrue(TEXT("Declared key should still be set"), First.GetBlackboardValue(TEXT("Stamina"), Declared));
+    TestEqual(TEXT("Declared key should keep its type"), Declared.Type, EBlackboardValueType::Float);
+    TestEqual(TEXT("Declared key should keep its value"), Declared.FloatValue, 1.0f);
+
+    // Declared Object keys keep their type (a null default) so Object handles resolve and write
+    FEAISBlackboardKeyHandle BallHandle(TEXT("Ball"), EBlackboardValueType::Object);
+    TestTrue(TEXT("Declared Object key should resolve"), First.ResolveKeyHandle(BallHandle));
+    TestNull(TEXT("Object default should be null"), First.GetBlackboardObject(BallHandle));
+    UObject *BallObject = NewObject<UAIBehaviour>();
+    First.SetBlackboardObject(BallHandle, BallObject);
+    TestTrue(TEXT("Object handle write should land"), First.GetBlackboardObject(BallHandle) == BallObject);
+
+    // Undeclared keys fall back to the key
+    FEAISBlackboardKeyHandle Dynamic(TEXT("Score"), EBlackboardValueType::Int);
+    TestFalse(TEXT("Undeclared key should not resolve"), First.ResolveKeyHandle(Dynamic));
+    First.SetBlackboardInt(Dynamic, 3);
+    TestEqual(TEXT("Undeclared key should still be written"), First.GetBlackboardInt(Dynamic), 3);
+
+    return true;
+}
+
+// ==============================================================================
+// EAIS.Core.BatchedTransitionStaleRank
+// ==============================================================================
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FEAISBatchedTransitionStaleRankTest, "EAIS.Core.BatchedTransitionStaleRank",
+                                 EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FEAISBatchedTransitionStaleRankTest::RunTest(const FString &Parameters)
+{
+    auto MakeTransition = [](const TCHAR *To, const TCHAR *Key)
+    {
+        FAITransition Trans;
+        Trans.To = To;
+        Trans.Condition.Type = EAIConditionType::Blackboard;
+        Trans.Condition.Name = Key;
+        Trans.Condition.Value = TEXT("true");
+        return Trans;
+    };
+
+    // Idle -> Attack on Go; Hurt -> Dead only when Dead is set
+    FAIBehaviorDef Def;
+    Def.Name = TEXT("StaleRankTest");
+    Def.InitialState = TEXT("Idle");
+    Def.bIsValid = true;
+
+    FAIState Idle;
+    Idle.Id = TEXT("Idle");
+    Idle.Transitions.Add(MakeTransition(TEXT("Attack"), TEXT("Go")));
+    Def.States.Add(Idle);
+
+    FAIState Hurt;
+    Hurt.Id = TEXT("Hurt");
+    Hurt.Transitions.Add(MakeTransition(TEXT("Dead"), TEXT("Dead")));
+    Def.States.Add(Hurt);
+
+    for (const TCHAR *Id : {TEXT("Attack"), TEXT("Dead")})
+    {
+        FAIState State;
+        State.Id = Id;
+        Def.States.Add(State);
+    }
+
+    const TSharedPtr<const FEAISCompiledProgram> Program = FEAISCompiledProgram::Compile(Def);
+    FAIInterpreter First;
+    FAIInterpreter Second;
+    for (FAIInterpreter *Agent : {&First, &Second})
+    {
+        Agent->LoadFromProgram(Program);
+        Agent->Reset();
+        Agent->SetBlackboardBool(TEXT("Go"), true);
+        Agent->BeginTick(0.1f);
+    }
+
+    TArray<FAIInterpreter *> Batch = {&First, &Second};
+    TArray<int32> Ranks;
+    Ranks.SetNumUninitialized(Batch.Num());
+    FEAISTransitionBatchScratch Scratch;
+    FAIInterpreter::SelectTransitionsBatch(Batch, Ranks, Scratch);
+    const int32 SelectedState = First.GetCurrentStateIndex();
+    TestEqual(TEXT("Both agents should select Idle -> Attack"), Ranks[1], Ranks[0]);
+
+    // The first agent entering Attack forces the second one into Hurt before its rank is applied
+    First.OnStateChanged.AddLambda([&Second](const FEAISStateChange &Change)
+    {
+        Second.ForceTransition(TEXT("Hurt"));
+    });
+
+    First.EndTick(Ranks[0], Program.Get(), SelectedState);
+    Second.EndTick(Ranks[1], Program.Get(), SelectedState);
+
+    TestEqual(TEXT("First agent should be in Attack"), First.GetCurrentStateId(), FString(TEXT("Attack")));
+    TestEqual(TEXT("Stale rank should be reselected in Hurt, not applied"), Second.GetCurrentStateId(), FString(TEXT("Hurt")));
+
+    return true;
+}
+
+// ==============================================================================
+// EAIS.Core.ConfigBlackboardDefaults
+// ==============================================================================
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FEAISConfigBlackboardDefaultsTest, "EAIS.Core.ConfigBlackboardDefaults",
+                                 EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FEAISConfigBlackboardDefaultsTest::RunTest(const FString &Parameters)
+{
+    // The plugin's Config/DefaultEAIS.ini declares HasBall=false and Role=""
+    const FEAISBlackboardEntry *Configured = EAIS::GetConfigBlackboardDefaults().FindByPredicate(
+        [](const FEAISBlackboardEntry &Entry) { return Entry.Key == TEXT("HasBall"); });
+    TestNotNull(TEXT("[EAIS.Blackboard] should be read from DefaultEAIS.ini"), Configured);
+
+    FAIState Idle;
+    Idle.Id = TEXT("Idle");
+
+    FAIBehaviorDef Def;
+    Def.Name = TEXT("ConfigDefaultsTest");
+    Def.InitialState = TEXT("Idle");
+    Def.bIsValid = true;
+    Def.States.Add(Idle);
+
+    // The behavior's own default wins over the config
+    FEAISBlackboardEntry Role;
+    Role.Key = TEXT("Role");
+    Role.Value.Type = EBlackboardValueType::String;
+    Role.Value.RawValue = TEXT("Striker");
+    Def.Blackboard.Add(Role);
+
+    TSharedRef<const FEAISCompiledProgram> Program = FEAISCompiledProgram::Compile(Def);
+
+    const int32 HasBallSlot = Program->FindSlot(TEXT("HasBall"));
+    TestTrue(TEXT("Merged key should get a slot"), HasBallSlot != INDEX_NONE);
+    if (HasBallSlot != INDEX_NONE)
+    {
+        TestTrue(TEXT("Merged default should be in the default image"), Program->DefaultImageSet[HasBallSlot]);
+        TestEqual(TEXT("Merged default type"), Program->DefaultImage[HasBallSlot].Type, EBlackboardValueType::Bool);
+        TestFalse(TEXT("Merged default value"), Program->DefaultImage[HasBallSlot].BoolValue);
+    }
+
+    const int32 RoleSlot = Program->FindSlot(TEXT("Role"));
+    TestTrue(TEXT("Declared key should have a slot"), RoleSlot != INDEX_NONE);
+    if (RoleSlot != INDEX_NONE)
+    {
+        TestEqual(TEXT("Declared default should win"), Program->DefaultImage[RoleSlot].StringValue, FString(TEXT("Striker")));
+    }
+
+    return true;
+}
+
+// ==============================================================================
+// EAIS.Core.InputMapping
+// ==============================================================================
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FEAISInputMappingTest, "EAIS.Core.InputMapping",
+                                 EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FEAISInputMappingTest::RunTest(const FString &Parameters)
+{
+    // The plugin's Config/DefaultEAIS.ini maps Jump -> JumpCommand
+    FAITransition Trans;
+    Trans.To = TEXT("Jumping");
+    Trans.Condition.Type = EAIConditionType::Event;
+    Trans.Condition.Name = TEXT("JumpCommand");
+
+    FAIState Idle;
+    Idle.Id = TEXT("Idle");
+    Idle.Transitions.Add(Trans);
+
+    FAIState Jumping;
+    Jumping.Id = TEXT("Jumping");
+
+    FAIBehaviorDef Def;
+    Def.Name = TEXT("InputMappingTest");
+    Def.InitialState = TEXT("Idle");
+    Def.bIsValid = true;
+    Def.States.Add(Idle);
+    Def.States.Add(Jumping);
+
+    TSharedRef<const FEAISCompiledProgram> Program = FEAISCompiledProgram::Compile(Def);
+    const int32 EventId = Program->FindInputEvent(TEXT("Jump"));
+    TestEqual(TEXT("Jump should map to the JumpCommand event id"), EventId, Program->FindEvent(TEXT("JumpCommand")));
+    TestTrue(TEXT("Mapped event should be interned"), EventId != INDEX_NONE);
+    TestEqual(TEXT("Unmapped action"), Program->FindInputEvent(TEXT("NotAnAction")), INDEX_NONE);
+
+    FAIInterpreter Interpreter;
+    Interpreter.LoadFromProgram(Program);
+    Interpreter.Reset();
+
+    FString Received;
+    Interpreter.OnEventReceived.AddLambda([&Received](const FString &EventName, const FAIEventPayload &Payload)
+    {
+        Received = EventName;
+    });
+
+    Interpreter.EnqueueEventId(EventId);
+    Interpreter.Tick(0.1f);
+    TestEqual(TEXT("Event enqueued by id should drive the transition"), Interpreter.GetCurrentStateId(), FString(TEXT("Jumping")));
+    TestEqual(TEXT("Listeners should get the event name"), Received, FString(TEXT("JumpCommand")));
+
+    return true;
+}
+
+// ==============================================================================
+// EAIS.Core.ActionParamParsing
+// ==============================================================================
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FEAISActionParamParsingTest, "EAIS.Core.ActionParamParsing",
+                                 EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FEAISActionParamParsingTest::RunTest(const FString &Parameters)
+{
+    auto MakeEntry = [](const TCHAR *Action, const TCHAR *Target, const TCHAR *Key, const TCHAR *Value)
+    {
+        FAIActionEntry Entry;
+        Entry.Action = Action;
+        Entry.Params.Target = Target;
+        if (Key)
+        {
+            Entry.Params.ExtraParams.Add(Key, Value);
+        }
+        return Entry;
+    };
+
+    FAIState State;
+    State.Id = TEXT("Idle");
+    State.OnEnter.Add(MakeEntry(TEXT("MoveTo"), TEXT("(X=1.0,Y=2.0,Z=3.0)"), nullptr, nullptr));
+    State.OnEnter.Add(MakeEntry(TEXT("MoveTo"), TEXT("Goal"), nullptr, nullptr));
+    State.OnEnter.Add(MakeEntry(TEXT("SetBlackboardKey"), TEXT("Speed"), TEXT("value"), TEXT("2.5")));
+    State.OnEnter.Add(MakeEntry(TEXT("SetBlackboardKey"), TEXT("Ready"), TEXT("value"), TEXT("TRUE")));
+    State.OnEnter.Add(MakeEntry(TEXT("SetBlackboardKey"), TEXT("Mode"), TEXT("value"), TEXT("Attack")));
+    State.OnEnter.Add(MakeEntry(TEXT("SetBlackboardKey"), TEXT("Empty"), nullptr, nullptr));
+    State.OnEnter.Add(MakeEntry(TEXT("InjectInput"), TEXT("IA_Jump"), TEXT("trigger"), TEXT("Pressed")));
+
+    FAIBehaviorDef Def;
+    Def.Name = TEXT("ParamTest");
+    Def.InitialState = TEXT("Idle");
+    Def.bIsValid = true;
+    Def.States.Add(State);
+
+    TSharedRef<const FEAISCompiledProgram> Program = FEAISCompiledProgram::Compile(Def);
+    const TArray<FAIActionEntry> &Entries = Program->Def.States[0].OnEnter;
+    const UClass *MoveTo = UAIAction_MoveTo::StaticClass();
+    const UClass *SetKey = UAIAction_SetBlackboardKey::StaticClass();
+
+    // Vector: parsed from "(X=..)" only; a key name leaves it unset
+    const FEAISParamValue *Location = Entries[0].Params.GetParam(MoveTo, 0);
+    TestTrue(TEXT("Vector literal should be parsed at compile time"), Location != nullptr);
+    if (Location)
+    {
+        TestEqual(TEXT("Vector value"), Location->Value.VectorValue, FVector(1.0f, 2.0f, 3.0f));
+    }
+    TestNull(TEXT("Non-vector target should stay unset"), Entries[1].Params.GetParam(MoveTo, 0));
+
+    // Auto: number -> Float, true/false -> Bool, anything else -> String
+    const FEAISParamValue *Speed = Entries[2].Params.GetParam(SetKey, 0);
+    const FEAISParamValue *Ready = Entries[3].Params.GetParam(SetKey, 0);
+    const FEAISParamValue *Mode = Entries[4].Params.GetParam(SetKey, 0);
+    TestTrue(TEXT("Auto values should be parsed"), Speed && Ready && Mode);
+    if (Speed && Ready && Mode)
+    {
+        TestEqual(TEXT("Numeric auto is Float"), Speed->Value.Type, EBlackboardValueType::Float);
+        TestEqual(TEXT("Float value"), Speed->Value.FloatValue, 2.5f);
+        TestEqual(TEXT("true auto is Bool"), Ready->Value.Type, EBlackboardValueType::Bool);
+        TestTrue(TEXT("Bool value"), Ready->Value.BoolValue);
+        TestEqual(TEXT("Other auto is String"), Mode->Value.Type, EBlackboardValueType::String);
+        TestEqual(TEXT("String value"), Mode->Value.StringValue, FString(TEXT("Attack")));
+    }
+    TestNull(TEXT("Missing param should be unset"), Entries[5].Params.GetParam(SetKey, 0));
+
+    // Name: interned once
+    const FEAISParamValue *Trigger = Entries[6].Params.GetParam(UAIAction_InjectInput::StaticClass(), 0);
+    TestTrue(TEXT("Name param should be parsed"), Trigger != nullptr);
+    if (Trigger)
+    {
+        TestEqual(TEXT("Name value"), Trigger->Name, FName(TEXT("Pressed")));
+    }
+
+    // A block laid out by one class's schema is never read by another
+    TestNull(TEXT("Block should only serve its schema owner"), Entries[2].Params.GetParam(MoveTo, 0));
+
+    // Runtime-built params get the same block once prepared
+    FAIActionParams Runtime;
+    Runtime.ExtraParams.Add(TEXT("value"), TEXT("7"));
+    GetMutableDefault<UAIAction_SetBlackboardKey>()->PrepareParams(Runtime);
+    const FEAISParamValue *RuntimeValue = Runtime.GetParam(SetKey, 0);
+    TestTrue(TEXT("Prepared runtime params should be parsed"), RuntimeValue != nullptr);
+    if (RuntimeValue)
+    {
+        TestEqual(TEXT("Runtime value"), RuntimeValue->Value.FloatValue, 7.0f);
+    }
+
+    return true;
+}
+
+// ==============================================================================
+// EAIS.Core.LatentActionLifecycle
+// ==============================================================================
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FEAISLatentActionLifecycleTest, "EAIS.Core.LatentActionLifecycle",
+                                 EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FEAISLatentActionLifecycleTest::RunTest(const FString &Parameters)
+{
+    // Actions are looked up through the game instance's subsystem, so the agent needs a world
+    UGameInstance *GameInstance = NewObject<UGameInstance>(GEngine);
+    GameInstance->InitializeStandalone();
+    UWorld *World = GameInstance->GetWorld();
+    UEAISSubsystem *Subsystem = GameInstance->GetSubsystem<UEAISSubsystem>();
+    if (!TestNotNull(TEXT("Subsystem"), Subsystem))
+    {
+        GameInstance->Shutdown();
+        return false;
+    }
+
+    Subsystem->RegisterAction(TEXT("TestLatent"), UEAISTestLatentAction::StaticClass());
+    UEAISTestLatentAction *Stub = Cast<UEAISTestLatentAction>(Subsystem->GetAction(TEXT("TestLatent")));
+    AActor *Actor = World->SpawnActor<AActor>();
+    UAIComponent *Component = NewObject<UAIComponent>(Actor);
+
+    FAIActionEntry Entry;
+    Entry.Action = TEXT("TestLatent");
+
+    // Higher priority: leave on event. Lower: leave once the action failed (a success must not match the mask)
+    FAITransition Leave;
+    Leave.To = TEXT("Gone");
+    Leave.Priority = 10;
+    Leave.Condition.Type = EAIConditionType::Event;
+    Leave.Condition.Name = TEXT("Leave");
+
+    FAITransition OnFailed;
+    OnFailed.To = TEXT("Done");
+    OnFailed.Condition.Type = EAIConditionType::Action;
+    OnFailed.Condition.Name = TEXT("TestLatent");
+    OnFailed.Condition.Value = TEXT("Failed");
+
+    FAIState Idle;
+    Idle.Id = TEXT("Idle");
+    Idle.OnTick.Add(Entry);
+    Idle.Transitions.Add(Leave);
+    Idle.Transitions.Add(OnFailed);
+
+    FAIState Done;
+    Done.Id = TEXT("Done");
+    FAIState Gone;
+    Gone.Id = TEXT("Gone");
+
+    // Two entries of the same (shared) action instance
+    FAIActionEntry First = Entry;
+    First.Params.Target = TEXT("A");
+    FAIActionEntry Second = Entry;
+    Second.Params.Target = TEXT("B");
+    FAIState Twin;
+    Twin.Id = TEXT("Twin");
+    Twin.OnTick.Add(First);
+    Twin.OnTick.Add(Second);
+
+    FAIBehaviorDef Def;
+    Def.Name = TEXT("LatentTest");
+    Def.InitialState = TEXT("Idle");
+    Def.bIsValid = true;
+    Def.States.Add(Idle);
+    Def.States.Add(Done);
+    Def.States.Add(Gone);
+    Def.States.Add(Twin);
+
+    FAIInterpreter Interpreter;
+    Interpreter.LoadFromDef(Def);
+    Interpreter.Initialize(Component);
+
+    // Started once, then ticked instead of re-executed while running
+    Interpreter.Tick(0.1f);
+    TestEqual(TEXT("First tick executes the OnTick action"), Stub->NumExecutes, 1);
+    TestEqual(TEXT("Action should be running"), Interpreter.GetNumRunningActions(), 1);
+    Interpreter.Tick(0.1f);
+    TestEqual(TEXT("Running action is not re-executed"), Stub->NumExecutes, 1);
+    TestEqual(TEXT("Running action is ticked"), Stub->NumTicks, 1);
+
+    // Finishing holds the entry for one tick so transitions can see the status
+    Stub->TickStatus = EAIActionStatus::Succeeded;
+    Interpreter.Tick(0.1f);
+    TestEqual(TEXT("Just finished action is not restarted in the same tick"), Stub->NumExecutes, 1);
+    TestEqual(TEXT("Succeeded does not match a Failed mask"), Interpreter.GetCurrentStateId(), FString(TEXT("Idle")));
+    Interpreter.Tick(0.1f);
+    TestEqual(TEXT("Finished action restarts on the next tick"), Stub->NumExecutes, 2);
+
+    Stub->TickStatus = EAIActionStatus::Failed;
+    Interpreter.Tick(0.1f);
+    TestEqual(TEXT("Failed matches the Failed mask"), Interpreter.GetCurrentStateId(), FString(TEXT("Done")));
+    TestEqual(TEXT("Finished actions are not aborted"), Stub->NumAborts, 0);
+
+    // Leaving a state aborts what is still running there
+    Stub->TickStatus = EAIActionStatus::Running;
+    Interpreter.ForceTransition(TEXT("Idle"));
+    Interpreter.Tick(0.1f);
+    TestEqual(TEXT("Action restarted in the new visit"), Stub->NumExecutes, 3);
+    Interpreter.EnqueueEvent(TEXT("Leave"), FAIEventPayload());
+    Interpreter.Tick(0.1f);
+    TestEqual(TEXT("Event transition applied"), Interpreter.GetCurrentStateId(), FString(TEXT("Gone")));
+    TestEqual(TEXT("Running action is aborted on ExitState"), Stub->NumAborts, 1);
+    TestEqual(TEXT("No records survive the exit"), Interpreter.GetNumRunningActions(), 0);
+
+    // A running action whose Execute changed state has no record left to abort it later
+    Interpreter.ForceTransition(TEXT("Idle"));
+    Stub->OnExecute = [&Interpreter]() { Interpreter.ForceTransition(TEXT("Done")); };
+    Interpreter.Tick(0.1f);
+    Stub->OnExecute = nullptr;
+    TestEqual(TEXT("Execute forced the transition"), Interpreter.GetCurrentStateId(), FString(TEXT("Done")));
+    TestEqual(TEXT("Running action is aborted when Execute leaves the state"), Stub->NumAborts, 2);
+
+    // FinishLatentAction finishes the entry it was called for, not the first running one of that action
+    Interpreter.ForceTransition(TEXT("Twin"));
+    Interpreter.Tick(0.1f);
+    TestEqual(TEXT("Both entries run"), Interpreter.GetNumRunningActions(), 2);
+    const TArray<FAIActionEntry> &TwinEntries = Interpreter.GetProgram()->Def.States[3].OnTick;
+    TestTrue(TEXT("Second entry finishes"), Interpreter.FinishRunningAction(Stub, TwinEntries[1].Params, EAIActionStatus::Succeeded));
+    TestFalse(TEXT("Second entry is no longer running"), Interpreter.FinishRunningAction(Stub, TwinEntries[1].Params, EAIActionStatus::Succeeded));
+    const FAIActionParams CopiedParams = TwinEntries[0].Params;
+    TestTrue(TEXT("A copy of the first entry's params (as from Blueprint) finishes it"), Interpreter.FinishRunningAction(Stub, CopiedParams, EAIActionStatus::Failed));
+    TestEqual(TEXT("Nothing left running"), Interpreter.GetNumRunningActions(), 0);
+
+    Actor->Destroy();
+    GameInstance->Shutdown();
+    GEngine->DestroyWorldContext(World);
+    World->DestroyWorld(false);
+    return true;
+}
+
+// ==============================================================================
+// EAIS.Core.EditorJsonRoundTrip
+// ==============================================================================
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FEAISEditorJsonRoundTripTest, "EAIS.Core.EditorJsonRoundTrip",
+                                 EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FEAISEditorJsonRoundTripTest::RunTest(const FString &Parameters)
+{
+    const FString Json = TEXT(R"({
+        "name": "QueryProfile",
+        "initialState": "Idle",
+        "maxTransitionsPerTick": 0,
+        "states": [ { "id": "Idle" } ],
+        "queries": [
+            {
+                "name": "BestPass",
+                "generator": "Grid",
+                "role": "Striker",
+                "gridRadius": 800.0,
+                "gridSpacing": 100.0,
+                "result": "PassTarget",
+                "tests": [
+                    { "type": "Distance", "min": 300.0, "max": 2500.0, "weight": -1.0, "filter": true },
+                    { "type": "LineOfSight", "weight": 2.0 }
+                ]
+            }
+        ]
+    })");
+
+    FAIBehaviorDef Def;
+    TMap<FString, FEAIS_EditorNodeData> Nodes;
+    FEAIS_EditorViewportData Viewport;
+    TestTrue(TEXT("Should parse"), FEAISJsonEditorParser::LoadFromJson(Json, Def, Nodes, Viewport));
+    TestEqual(TEXT("maxTransitionsPerTick is clamped to 1"), Def.MaxTransitionsPerTick, 1);
+    TestEqual(TEXT("Query parsed"), Def.Queries.Num(), 1);
+
+    // Save and load again: the query must survive unchanged
+    Def.MaxTransitionsPerTick = 3;
+    FString Saved;
+    TestTrue(TEXT("Should save"), FEAISJsonEditorParser::SaveToJson(Def, Nodes, Viewport, Saved));
+
+    FAIBehaviorDef Reloaded;
+    TestTrue(TEXT("Should reparse"), FEAISJsonEditorParser::LoadFromJson(Saved, Reloaded, Nodes, Viewport));
+    TestEqual(TEXT("maxTransitionsPerTick survives"), Reloaded.MaxTransitionsPerTick, 3);
+    TestEqual(TEXT("Query survives"), Reloaded.Queries.Num(), 1);
+    if (Reloaded.Queries.Num() == 1)
+    {
+        const FEAISQueryDef &Query = Reloaded.Queries[0];
+        TestEqual(TEXT("Name"), Query.Name, FString(TEXT("BestPass")));
+        TestEqual(TEXT("Generator"), Query.Generator, EEAISQueryGenerator::Grid);
+        TestEqual(TEXT("Role"), Query.Role, FName(TEXT("Striker")));
+        TestEqual(TEXT("Grid radius"), Query.GridRadius, 800.0f);
+        TestEqual(TEXT("Grid spacing"), Query.GridSpacing, 100.0f);
+        TestEqual(TEXT("Result key"), Query.ResultKey, FString(TEXT("PassTarget")));
+        TestEqual(TEXT("Tests"), Query.Tests.Num(), 2);
+        if (Query.Tests.Num() == 2)
+        {
+            TestEqual(TEXT("Distance test"), Query.Tests[0].Type, EEAISQueryTestType::Distance);
+            TestEqual(TEXT("Distance weight"), Query.Tests[0].Weight, -1.0f);
+            TestTrue(TEXT("Distance filter"), Query.Tests[0].bFilter);
+            TestEqual(TEXT("Line of sight test"), Query.Tests[1].Type, EEAISQueryTestType::LineOfSight);
+            TestFalse(TEXT("Line of sight filter"), Query.Tests[1].bFilter);
+        }
+    }
+
+    return true;
+}
+
+// ==============================================================================
+// EAIS.Core.EventTransitionDispatch
+// ==============================================================================
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FEAISEventTransitionDispatchTest, "EAIS.Core.EventTransitionDispatch",
+                                 EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FEAISEventTransitionDispatchTest::RunTest(const FString &Parameters)
+{
+    auto MakeKey = [](const TCHAR *Key)
+    {
+        FAICondition Condition;
+        Condition.Type = EAIConditionType::Blackboard;
+        Condition.Name = Key;
+        Condition.Value = TEXT("true");
+        return Condition;
+    };
+    auto MakeEvent = [](const TCHAR *Event)
+    {
+        FAICondition Condition;
+        Condition.Type = EAIConditionType::Event;
+        Condition.Name = Event;
+        return Condition;
+    };
+    auto MakeComposite = [](EAIConditionType Type, const FAICondition &A, const FAICondition *B)
+    {
+        FAICondition Condition;
+        Condition.Type = Type;
+        Condition.SubConditions.Add(A);
+        if (B)
+        {
+            Condition.SubConditions.Add(*B);
+        }
+        return Condition;
+    };
+    auto MakeTransition = [](const TCHAR *To, int32 Priority, const FAICondition &Condition)
+    {
+        FAITransition Trans;
+        Trans.To = To;
+        Trans.Priority = Priority;
+        Trans.Condition = Condition;
+        return Trans;
+    };
+
+    const FAICondition Never = MakeKey(TEXT("Never"));
+    const FAICondition Ready = MakeKey(TEXT("Ready"));
+
+    // Sorted ranks in Idle: High (0), Go (1), Alt (2), Low (3)
+    FAIState Idle;
+    Idle.Id = TEXT("Idle");
+    Idle.Transitions.Add(MakeTransition(TEXT("Go"), 5, MakeComposite(EAIConditionType::And, MakeEvent(TEXT("Go")), &Ready)));
+    Idle.Transitions.Add(MakeTransition(TEXT("High"), 10, MakeKey(TEXT("High"))));
+    Idle.Transitions.Add(MakeTransition(TEXT("Low"), 1, MakeKey(TEXT("Low"))));
+    Idle.Transitions.Add(MakeTransition(TEXT("Alt"), 4, MakeComposite(EAIConditionType::Or, MakeEvent(TEXT("Alt")), &Never)));
+
+    FAIState Guard;
+    Guard.Id = TEXT("Guard");
+    Guard.Transitions.Add(MakeTransition(TEXT("Free"), 0, MakeComposite(EAIConditionType::Not, MakeEvent(TEXT("Stay")), nullptr)));
+
+    FAIBehaviorDef Def;
+    Def.Name = TEXT("EventDispatchTest");
+    Def.InitialState = TEXT("Idle");
+    Def.bIsValid = true;
+    Def.States.Add(Idle);
+    Def.States.Add(Guard);
+    for (const TCHAR *Id : { TEXT("Go"), TEXT("High"), TEXT("Low"), TEXT("Alt"), TEXT("Free") })
+    {
+        FAIState Target;
+        Target.Id = Id;
+        Def.States.Add(Target);
+    }
+
+    TSharedRef<const FEAISCompiledProgram> Program = FEAISCompiledProgram::Compile(Def);
+
+    // And(Event, ...) is dispatched by its event; Or/Not around an event stay on the non-event path
+    const FEAISCompiledState &IdleState = Program->States[0];
+    TestTrue(TEXT("Idle non-event ranks"), IdleState.NonEventRanks == TArray<int32>({ 0, 2, 3 }));
+    const TArray<int32> *GoRanks = IdleState.EventRanks.Find(Program->FindEvent(TEXT("Go")));
+    TestTrue(TEXT("And(Event) is dispatched by its event"), GoRanks && *GoRanks == TArray<int32>({ 1 }));
+    TestNull(TEXT("Or(Event) is not dispatched by its event"), IdleState.EventRanks.Find(Program->FindEvent(TEXT("Alt"))));
+    TestEqual(TEXT("Not(Event) stays on the non-event path"), Program->States[1].NonEventRanks.Num(), 1);
+
+    FAIInterpreter Interpreter;
+    Interpreter.LoadFromProgram(Program);
+    Interpreter.Reset();
+
+    // And(Event, Blackboard): needs both the event and its blackboard part
+    Interpreter.EnqueueEvent(TEXT("Go"), FAIEventPayload());
+    Interpreter.Tick(0.1f);
+    TestEqual(TEXT("Event alone does not fire And"), Interpreter.GetCurrentStateId(), FString(TEXT("Idle")));
+    Interpreter.SetBlackboardBool(TEXT("Ready"), true);
+    Interpreter.Tick(0.1f);
+    TestEqual(TEXT("Blackboard alone does not fire And"), Interpreter.GetCurrentStateId(), FString(TEXT("Idle")));
+    Interpreter.EnqueueEvent(TEXT("Go"), FAIEventPayload());
+    Interpreter.Tick(0.1f);
+    TestEqual(TEXT("Event and blackboard fire And"), Interpreter.GetCurrentStateId(), FString(TEXT("Go")));
+
+    // An event rank beats a lower-priority non-event rank...
+    Interpreter.ForceTransition(TEXT("Idle"));
+    Interpreter.SetBlackboardBool(TEXT("Low"), true);
+    Interpreter.EnqueueEvent(TEXT("Go"), FAIEventPayload());
+    Interpreter.Tick(0.1f);
+    TestEqual(TEXT("Event rank beats lower priority"), Interpreter.GetCurrentStateId(), FString(TEXT("Go")));
+
+    // ...and loses to a higher one
+    Interpreter.ForceTransition(TEXT("Idle"));
+    Interpreter.SetBlackboardBool(TEXT("High"), true);
+    Interpreter.EnqueueEvent(TEXT("Go"), FAIEventPayload());
+    Interpreter.Tick(0.1f);
+    TestEqual(TEXT("Higher non-event rank beats event rank"), Interpreter.GetCurrentStateId(), FString(TEXT("High")));
+
+    // Or(Event, ...) still sees the event from the non-event path
+    Interpreter.SetBlackboardBool(TEXT("High"), false);
+    Interpreter.SetBlackboardBool(TEXT("Low"), false);
+    Interpreter.ForceTransition(TEXT("Idle"));
+    Interpreter.EnqueueEvent(TEXT("Alt"), FAIEventPayload());
+    Interpreter.Tick(0.1f);
+    TestEqual(TEXT("Or(Event) fires on its event"), Interpreter.GetCurrentStateId(), FString(TEXT("Alt")));
+
+    // Not(Event) holds while the event is present and fires without it
+    Interpreter.ForceTransition(TEXT("Guard"));
+    Interpreter.EnqueueEvent(TEXT("Stay"), FAIEventPayload());
+    Interpreter.Tick(0.1f);
+    TestEqual(TEXT("Not(Event) blocks while the event arrives"), Interpreter.GetCurrentStateId(), FString(TEXT("Guard")));
+    Interpreter.Tick(0.1f);
+    TestEqual(TEXT("Not(Event) fires without the event"), Interpreter.GetCurrentStateId(), FString(TEXT("Free")));
+
+    return true;
+}
+
+// ==============================================================================
+// EAIS.Core.InterpreterPool
+// ==============================================================================
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FEAISInterpreterPoolTest, "EAIS.Core.InterpreterPool",
+                                 EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FEAISInterpreterPoolTest::RunTest(const FString &Parameters)
+{
+    FAIActionEntry Latent;
+    Latent.Action = TEXT("TestLatent");
+
+    FAITransition OnGo;
+    OnGo.To = TEXT("Run");
+    OnGo.Condition.Type = EAIConditionType::Event;
+    OnGo.Condition.Name = TEXT("Go");
+
+    FAIState Idle;
+    Idle.Id = TEXT("Idle");
+    Idle.OnTick.Add(Latent);
+    Idle.Transitions.Add(OnGo);
+    FAIState Run;
+    Run.Id = TEXT("Run");
+
+    FEAISBlackboardEntry Stamina;
+    Stamina.Key = TEXT("Stamina");
+    Stamina.Value.Type = EBlackboardValueType::Float;
+    Stamina.Value.RawValue = TEXT("1.0");
+
+    FAIBehaviorDef Def;
+    Def.Name = TEXT("PoolTest");
+    Def.InitialState = TEXT("Idle");
+    Def.bIsValid = true;
+    Def.States.Add(Idle);
+    Def.States.Add(Run);
+    Def.Blackboard.Add(Stamina);
+    const TSharedPtr<const FEAISCompiledProgram> Program = FEAISCompiledProgram::Compile(Def);
+
+    // The pool size is read from the settings when the subsystem initializes
+    UEAISSettings *Settings = GetMutableDefault<UEAISSettings>();
+    const int32 SavedPoolSize = Settings->MaxPooledInterpretersPerProfile;
+
+    auto RunWithPoolSize = [&](int32 PoolSize, TFunctionRef<void(UEAISSubsystem *, UAIComponent *, UEAISTestLatentAction *)> Body)
+    {
+        Settings->MaxPooledInterpretersPerProfile = PoolSize;
+        UGameInstance *GameInstance = NewObject<UGameInstance>(GEngine);
+        GameInstance->InitializeStandalone();
+        UWorld *World = GameInstance->GetWorld();
+        UEAISSubsystem *Subsystem = GameInstance->GetSubsystem<UEAISSubsystem>();
+        if (TestNotNull(TEXT("Subsystem"), Subsystem))
+        {
+            Subsystem->RegisterAction(TEXT("TestLatent"), UEAISTestLatentAction::StaticClass());
+            UEAISTestLatentAction *Stub = Cast<UEAISTestLatentAction>(Subsystem->GetAction(TEXT("TestLatent")));
+            AActor *Actor = World->SpawnActor<AActor>();
+            Body(Subsystem, NewObject<UAIComponent>(Actor), Stub);
+            Actor->Destroy();
+        }
+        GameInstance->Shutdown();
+        GEngine->DestroyWorldContext(World);
+        World->DestroyWorld(false);
+    };
+
+    // Dirty an agent: changed blackboard, dynamic key, queued event, running action
+    auto MakeDirtyAgent = [&Program](FAIInterpreter &Agent, UAIComponent *Component)
+    {
+        Agent.LoadFromProgram(Program);
+        Agent.Initialize(Component);
+        Agent.Tick(0.1f);
+        Agent.SetBlackboardFloat(TEXT("Stamina"), 0.2f);
+        Agent.SetBlackboardBool(TEXT("Dynamic"), true);
+        Agent.EnqueueEvent(TEXT("Go"), FAIEventPayload());
+    };
+
+    RunWithPoolSize(4, [&](UEAISSubsystem *Subsystem, UAIComponent *Component, UEAISTestLatentAction *Stub)
+    {
+        FAIInterpreter Released;
+        MakeDirtyAgent(Released, Component);
+        TestEqual(TEXT("Released agent has a running action"), Released.GetNumRunningActions(), 1);
+
+        Subsystem->ReleaseInterpreter(Released);
+        TestEqual(TEXT("Release pools the storage"), Subsystem->GetNumPooledInterpreters(), 1);
+        TestFalse(TEXT("Released interpreter keeps no program"), Released.GetProgram().IsValid());
+        TestEqual(TEXT("Release aborts running actions"), Stub->NumAborts, 1);
+
+        // Observers belong to the receiving interpreter and survive the storage swap
+        FAIInterpreter Acquired;
+        int32 NumCalls = 0;
+        Acquired.ObserveBlackboardKey(TEXT("Stamina"), FOnEAISBlackboardChanged::FDelegate::CreateLambda(
+            [&NumCalls](const FString &Key, const FBlackboardValue &Value) { ++NumCalls; }));
+
+        TestTrue(TEXT("Acquire reuses the pooled storage"), Subsystem->AcquireInterpreter(Program, Acquired));
+        TestEqual(TEXT("Pool is empty again"), Subsystem->GetNumPooledInterpreters(), 0);
+        TestFalse(TEXT("Nothing pooled for a second acquire"), Subsystem->AcquireInterpreter(Program, Acquired));
+        Acquired.Initialize(Component);
+
+        TestEqual(TEXT("Blackboard is back to defaults"), Acquired.GetBlackboardFloat(TEXT("Stamina")), 1.0f);
+        FBlackboardValue Dynamic;
+        TestFalse(TEXT("Dynamic keys are dropped"), Acquired.GetBlackboardValue(TEXT("Dynamic"), Dynamic));
+        TestEqual(TEXT("No running actions carried over"), Acquired.GetNumRunningActions(), 0);
+
+        Stub->ExecuteStatus = EAIActionStatus::Succeeded;
+        Acquired.Tick(0.1f);
+        TestEqual(TEXT("Queued event was not carried over"), Acquired.GetCurrentStateId(), FString(TEXT("Idle")));
+
+        Acquired.SetBlackboardFloat(TEXT("Stamina"), 0.5f);
+        Acquired.DispatchBlackboardChanges();
+        TestEqual(TEXT("Observer fires after acquire"), NumCalls, 1);
+    });
+
+    RunWithPoolSize(0, [&](UEAISSubsystem *Subsystem, UAIComponent *Component, UEAISTestLatentAction *Stub)
+    {
+        FAIInterpreter Released;
+        MakeDirtyAgent(Released, Component);
+
+        Subsystem->ReleaseInterpreter(Released);
+        TestEqual(TEXT("Pool size 0 keeps nothing"), Subsystem->GetNumPooledInterpreters(), 0);
+        TestFalse(TEXT("Dropped interpreter keeps no program"), Released.GetProgram().IsValid());
+        TestEqual(TEXT("Dropped storage aborts running actions"), Stub->NumAborts, 1);
+
+        FAIInterpreter Acquired;
+        TestFalse(TEXT("Nothing to acquire"), Subsystem->AcquireInterpreter(Program, Acquired));
+    });
+
+    Settings->MaxPooledInterpretersPerProfile = SavedPoolSize;
+    return true;
+}
+
+// ==============================================================================
+// EAIS.Core.FixedStepScheduling
+// ==============================================================================
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FEAISFixedStepSchedulingTest, "EAIS.Core.FixedStepScheduling",
+                                 EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FEAISFixedStepSchedulingTest::RunTest(const FString &Parameters)
+{
+    // Power-of-two steps keep the accumulator arithmetic exact
+    const float Step = 0.25f;
+    UAIComponent *Component = NewObject<UAIComponent>();
+
+    // Step length: whole multiples of the base step covering the effective interval
+    TestEqual(TEXT("Every-frame agents use the base step"), Component->GetFixedStepSeconds(Step), 0.25f);
+    Component->TickInterval = 0.6f;
+    TestEqual(TEXT("Interval rounds up to a whole multiple"), Component->GetFixedStepSeconds(Step), 0.75f);
+    Component->TickInterval = 0.5f;
+    TestEqual(TEXT("Exact multiple is not rounded up"), Component->GetFixedStepSeconds(Step), 0.5f);
+    Component->SetLODTickInterval(1.0f);
+    TestEqual(TEXT("LOD interval wins when larger"), Component->GetFixedStepSeconds(Step), 1.0f);
+    Component->TickInterval = 0.0f;
+    Component->SetLODTickInterval(0.0f);
+
+    // Whole steps are taken and the remainder carries over
+    Component->AccumulateTickTime(0.625f);
+    TestEqual(TEXT("Two whole steps accumulated"), Component->ConsumeFixedSteps(Step, 4), 2);
+    TestEqual(TEXT("Remainder carries over"), Component->GetAccumulatedTickTime(), 0.125f);
+
+    // A hitch beyond MaxSteps drops the backlog but keeps the phase within the step
+    Component->AccumulateTickTime(2.0f);
+    TestEqual(TEXT("Backlog is capped at MaxSteps"), Component->ConsumeFixedSteps(Step, 4), 4);
+    TestEqual(TEXT("Phase is kept after dropping the backlog"), Component->GetAccumulatedTickTime(), 0.125f);
+
+    // A wake borrows a step; the next step waits for the borrowed time
+    Component->RequestWake();
+    TestEqual(TEXT("Wake borrows one step"), Component->ConsumeFixedSteps(Step, 4), 1);
+    TestEqual(TEXT("Accumulator goes negative"), Component->GetAccumulatedTickTime(), -0.125f);
+    TestFalse(TEXT("Wake is consumed"), Component->IsWakeRequested());
+    Component->AccumulateTickTime(0.25f);
+    TestEqual(TEXT("Borrowed time delays the next step"), Component->ConsumeFixedSteps(Step, 4), 0);
+    Component->AccumulateTickTime(0.125f);
+    TestEqual(TEXT("Step resumes once repaid"), Component->ConsumeFixedSteps(Step, 4), 1);
+    TestEqual(TEXT("Accumulator back to zero"), Component->GetAccumulatedTickTime(), 0.0f);
+
+    // Steps are taken in multiples of the agent's own step length
+    Component->TickInterval = 0.6f;
+    const float AgentStep = Component->GetFixedStepSeconds(Step);
+    Component->AccumulateTickTime(1.75f);
+    TestEqual(TEXT("Slow agent takes its longer steps"), Component->ConsumeFixedSteps(AgentStep, 4), 2);
+    TestEqual(TEXT("Slow agent keeps the remainder"), Component->GetAccumulatedTickTime(), 0.25f);
+
+    return true;
+}
+
+// ==============================================================================
+// EAIS.Core.UrgentEventWake
+// ==============================================================================
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FEAISUrgentEventWakeTest, "EAIS.Core.UrgentEventWake",
+                                 EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FEAISUrgentEventWakeTest::RunTest(const FString &Parameters)
+{
+    UAIComponent *Component = NewObject<UAIComponent>();
+    Component->TickInterval = 1.0f;
+
+    // Ordinary events wait for the tick interval
+    Component->EnqueueSimpleEvent(TEXT("Heard"), false);
+    TestFalse(TEXT("Non-urgent event does not wake"), Component->IsWakeRequested());
+    TestFalse(TEXT("Tick not due before the interval"), Component->IsTickDue());
+
+    // Urgent events wake the agent regardless of its interval
+    FAIEventPayload Urgent;
+    Urgent.bUrgent = true;
+    Component->EnqueueEvent(TEXT("Hit"), Urgent);
+    TestTrue(TEXT("Urgent event requests a wake"), Component->IsWakeRequested());
+    TestTrue(TEXT("Wake makes the tick due"), Component->IsTickDue());
+
+    Component->AccumulateTickTime(0.25f);
+    TestEqual(TEXT("Variable tick takes the accumulated time"), Component->ConsumeTickTime(), 0.25f);
+    TestFalse(TEXT("ConsumeTickTime clears the wake"), Component->IsWakeRequested());
+    TestFalse(TEXT("Tick no longer due"), Component->IsTickDue());
+
+    // The fixed-step path honours and clears the wake the same way
+    Component->EnqueueSimpleEvent(TEXT("Hit"), true);
+    TestTrue(TEXT("Urgent simple event requests a wake"), Component->IsWakeRequested());
+    TestEqual(TEXT("Wake borrows a fixed step"), Component->ConsumeFixedSteps(Component->GetFixedStepSeconds(0.25f), 4), 1);
+    TestFalse(TEXT("ConsumeFixedSteps clears the wake"), Component->IsWakeRequested());
+
+    return true;
+}
+
 #endif // WITH_DEV_AUTOMATION_TESTS
@@ -0,0 +1,54 @@
+/*
+ * @Author: Punal Manalan
+ * @Description: Stub actions used by the EAIS automation tests
+ * @Date: 18/10/2026
+ */
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "AIAction.h"
+#include "EAISTestActions.generated.h"
+
+/**
+ * Latent stub action: counts calls and returns the statuses the test sets
+ */
+UCLASS(NotBlueprintable, HideDropdown)
+class UEAISTestLatentAction : public UAIAction
+{
+    GENERATED_BODY()
+
+public:
+    virtual EAIActionStatus Execute_Implementation(UAIComponent* OwnerComponent, const FAIActionParams& Params) override
+    {
+        ++NumExecutes;
+        if (OnExecute)
+        {
+            OnExecute();
+        }
+        return ExecuteStatus;
+    }
+
+    virtual EAIActionStatus TickAction_Implementation(UAIComponent* OwnerComponent, const FAIActionParams& Params, float DeltaSeconds) override
+    {
+        ++NumTicks;
+        return TickStatus;
+    }
+
+    virtual void Abort_Implementation(UAIComponent* OwnerComponent) override { ++NumAborts; }
+
+    virtual FString GetActionName() const override { return TEXT("TestLatent"); }
+
+    /** Status returned by Execute */
+    EAIActionStatus ExecuteStatus = EAIActionStatus::Running;
+
+    /** Called from Execute (e.g. to change state under the running action) */
+    TFunction<void()> OnExecute;
+
+    /** Status returned by TickAction */
+    EAIActionStatus TickStatus = EAIActionStatus::Running;
+
+    int32 NumExecutes = 0;
+    int32 NumTicks = 0;
+    int32 NumAborts = 0;
+};
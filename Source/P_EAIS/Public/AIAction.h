@@ -13,9 +13,30 @@
 
 class UAIComponent;
 
+/**
+ * Parameters an action reads, declared once per action class.
+ * Index of each parameter = declaration order (read with UAIAction::GetParam).
+ */
+struct P_EAIS_API FEAISActionParamSchema
+{
+    struct FParam
+    {
+        /** Key in the entry's params ("target" falls back to FAIActionParams::Target) */
+        FString Key;
+        EEAISParamType Type = EEAISParamType::String;
+    };
+
+    TArray<FParam> Params;
+
+    /** Declare a parameter, returns its index */
+    int32 Add(const FString& Key, EEAISParamType Type) { return Params.Add({ Key, Type }); }
+};
+
 /**
  * Base class for AI actions.
  * Actions are registered with the subsystem and executed by the interpreter.
+ * One instance is shared by every agent, so per-agent progress lives in the interpreter
+ * (see FAIInterpreter::GetNumRunningActions), never in the action object.
  */
 UCLASS(Abstract, Blueprintable, BlueprintType)
 class P_EAIS_API UAIAction : public UObject
@@ -23,34 +44,62 @@ class P_EAIS_API UAIAction : public UObject
     GENERATED_BODY()
 
 public:
-    /** Execute the action */
+    /** Execute the action. Return Running to keep it ticking until it succeeds, fails or the state exits. */
+    UFUNCTION(BlueprintNativeEvent, Category = "AI Action")
+    EAIActionStatus Execute(UAIComponent* OwnerComponent, const FAIActionParams& Params);
+    virtual EAIActionStatus Execute_Implementation(UAIComponent* OwnerComponent, const FAIActionParams& Params) { return EAIActionStatus::Succeeded; }
+
+    /** Tick a running action. The default keeps it running until FinishLatentAction is called. */
     UFUNCTION(BlueprintNativeEvent, Category = "AI Action")
-    void Execute(UAIComponent* OwnerComponent, const FAIActionParams& Params);
-    virtual void Execute_Implementation(UAIComponent* OwnerComponent, const FAIActionParams& Params) {}
+    EAIActionStatus TickAction(UAIComponent* OwnerComponent, const FAIActionParams& Params, float DeltaSeconds);
+    virtual EAIActionStatus TickAction_Implementation(UAIComponent* OwnerComponent, const FAIActionParams& Params, float DeltaSeconds) { return EAIActionStatus::Running; }
 
-    /** Abort the action if it's running */
+    /** Abort a running action (called when its state exits or the AI stops) */
     UFUNCTION(BlueprintNativeEvent, Category = "AI Action")
-    void Abort();
-    virtual void Abort_Implementation() {}
+    void Abort(UAIComponent* OwnerComponent);
+    virtual void Abort_Implementation(UAIComponent* OwnerComponent) {}
 
     /** Get the action name for registry */
     UFUNCTION(BlueprintPure, Category = "AI Action")
     virtual FString GetActionName() const { return GetClass()->GetName(); }
 
-    /** Is this action currently running? */
-    UFUNCTION(BlueprintPure, Category = "AI Action")
-    bool IsRunning() const { return bIsRunning; }
+    /** Params this action declares (see DeclareParams), declared on first use */
+    const FEAISActionParamSchema& GetParamSchema();
+
+    /** Parse runtime-built params into their typed block once, so reusing them skips parsing (no-op if already built for this class) */
+    void PrepareParams(FAIActionParams& Params);
+
+    /** Action class a behavior's action name refers to: classes registered with UEAISSubsystem, else the class whose GetActionName matches */
+    static TSubclassOf<UAIAction> FindActionClass(const FString& ActionName);
+
+    /** Publish a registered name for FindActionClass (called by UEAISSubsystem::RegisterAction) */
+    static void RegisterActionClass(const FString& ActionName, TSubclassOf<UAIAction> ActionClass);
+
+    /** Parse params by the schema of ActionClass, null if the class declares none */
+    static TSharedPtr<const FEAISActionParamBlock> BuildParamBlock(TSubclassOf<UAIAction> ActionClass, const FAIActionParams& Params);
 
 protected:
-    /** Mark action as running */
-    void SetRunning(bool bRunning) { bIsRunning = bRunning; }
+    /** Declare the params this action reads; they are parsed once per action entry when the program is compiled */
+    virtual void DeclareParams(FEAISActionParamSchema& Schema) const {}
+
+    /** Typed param by schema index, null if not given. Params without a block built for this class are parsed on the spot into a per-action scratch value. */
+    const FEAISParamValue* GetParam(const FAIActionParams& Params, int32 Index);
 
-    /** Complete the action */
+    /** Resolve Params.Target to a location: "$Key" reads its slot only, other names try IEAIS_TargetProvider then the key of that name */
+    static bool ResolveTargetLocation(UAIComponent* OwnerComponent, const FAIActionParams& Params, FVector& OutLocation);
+
+    /** Finish this action for an agent (for actions that complete from callbacks instead of TickAction); Params identifies the entry */
     UFUNCTION(BlueprintCallable, Category = "AI Action")
-    void Complete();
+    void FinishLatentAction(UAIComponent* OwnerComponent, const FAIActionParams& Params, EAIActionStatus Status);
 
 private:
-    bool bIsRunning = false;
+    /** Declared params (filled on first use) */
+    FEAISActionParamSchema ParamSchema;
+
+    bool bParamSchemaDeclared = false;
+
+    /** Params parsed by GetParam for params without a block, one per schema index (reused, valid until that index is read again) */
+    TArray<FEAISParamValue> UnpreparedParams;
 };
 
 // ==================== Built-in Actions ====================
@@ -64,12 +113,20 @@ class P_EAIS_API UAIAction_MoveTo : public UAIAction
     GENERATED_BODY()
 
 public:
-    virtual void Execute_Implementation(UAIComponent* OwnerComponent, const FAIActionParams& Params) override;
-    virtual void Abort_Implementation() override;
+    virtual EAIActionStatus Execute_Implementation(UAIComponent* OwnerComponent, const FAIActionParams& Params) override;
+    virtual EAIActionStatus TickAction_Implementation(UAIComponent* OwnerComponent, const FAIActionParams& Params, float DeltaSeconds) override;
+    virtual void Abort_Implementation(UAIComponent* OwnerComponent) override;
     virtual FString GetActionName() const override { return TEXT("MoveTo"); }
 
+protected:
+    virtual void DeclareParams(FEAISActionParamSchema& Schema) const override;
+
 private:
-    TWeakObjectPtr<class UPathFollowingComponent> PathFollowingComp;
+    /** Resolve the move target for an agent */
+    bool ResolveTarget(UAIComponent* OwnerComponent, const FAIActionParams& Params, FVector& OutLocation);
+
+    /** Issue (or re-issue) the move request, throttled per agent */
+    EAIActionStatus RequestMove(UAIComponent* OwnerComponent, const FAIActionParams& Params);
 };
 
 /**
@@ -81,13 +138,33 @@ class P_EAIS_API UAIAction_Log : public UAIAction
     GENERATED_BODY()
 
 public:
-    virtual void Execute_Implementation(UAIComponent* OwnerComponent, const FAIActionParams& Params) override;
-    virtual void Abort_Implementation() override;
+    virtual EAIActionStatus Execute_Implementation(UAIComponent* OwnerComponent, const FAIActionParams& Params) override;
     virtual FString GetActionName() const override { return TEXT("Log"); }
+
+protected:
+    virtual void DeclareParams(FEAISActionParamSchema& Schema) const override;
 };
 
 /**
- * Kick action - kicks the ball (via P_MEIS injection)
+ * How a pawn class receives kicks, resolved once per class
+ */
+struct FEAISKickBinding
+{
+    /** Pawn implements IEAIS_KickHandler (direct virtual call) */
+    bool bNative = false;
+
+    /** Reflected ExecuteShoot, null if missing or its signature does not match */
+    TWeakObjectPtr<UFunction> Function;
+
+    /** Validated Direction (FVector) parameter */
+    FStructProperty* DirectionProperty = nullptr;
+
+    /** Validated Power (float or double) parameter */
+    FNumericProperty* PowerProperty = nullptr;
+};
+
+/**
+ * Kick action - calls IEAIS_KickHandler, or ExecuteShoot(FVector Direction, float Power) via reflection
  */
 UCLASS(BlueprintType)
 class P_EAIS_API UAIAction_Kick : public UAIAction
@@ -95,8 +172,15 @@ class P_EAIS_API UAIAction_Kick : public UAIAction
     GENERATED_BODY()
 
 public:
-    virtual void Execute_Implementation(UAIComponent* OwnerComponent, const FAIActionParams& Params) override;
+    virtual EAIActionStatus Execute_Implementation(UAIComponent* OwnerComponent, const FAIActionParams& Params) override;
     virtual FString GetActionName() const override { return TEXT("Kick"); }
+
+private:
+    /** Per pawn class binding cache */
+    TMap<TObjectKey<UClass>, FEAISKickBinding> Bindings;
+
+    /** Find or build the binding for a pawn class (validates ExecuteShoot's parameters once) */
+    const FEAISKickBinding& GetBinding(UClass* PawnClass);
 };
 
 /**
@@ -108,7 +192,7 @@ class P_EAIS_API UAIAction_AimAt : public UAIAction
     GENERATED_BODY()
 
 public:
-    virtual void Execute_Implementation(UAIComponent* OwnerComponent, const FAIActionParams& Params) override;
+    virtual EAIActionStatus Execute_Implementation(UAIComponent* OwnerComponent, const FAIActionParams& Params) override;
     virtual FString GetActionName() const override { return TEXT("AimAt"); }
 };
 
@@ -121,7 +205,7 @@ class P_EAIS_API UAIAction_SetLookTarget : public UAIAction
     GENERATED_BODY()
 
 public:
-    virtual void Execute_Implementation(UAIComponent* OwnerComponent, const FAIActionParams& Params) override;
+    virtual EAIActionStatus Execute_Implementation(UAIComponent* OwnerComponent, const FAIActionParams& Params) override;
     virtual FString GetActionName() const override { return TEXT("SetLookTarget"); }
 };
 
@@ -134,7 +218,7 @@ class P_EAIS_API UAIAction_Wait : public UAIAction
     GENERATED_BODY()
 
 public:
-    virtual void Execute_Implementation(UAIComponent* OwnerComponent, const FAIActionParams& Params) override;
+    virtual EAIActionStatus Execute_Implementation(UAIComponent* OwnerComponent, const FAIActionParams& Params) override;
     virtual FString GetActionName() const override { return TEXT("Wait"); }
 };
 
@@ -147,8 +231,11 @@ class P_EAIS_API UAIAction_SetBlackboardKey : public UAIAction
     GENERATED_BODY()
 
 public:
-    virtual void Execute_Implementation(UAIComponent* OwnerComponent, const FAIActionParams& Params) override;
+    virtual EAIActionStatus Execute_Implementation(UAIComponent* OwnerComponent, const FAIActionParams& Params) override;
     virtual FString GetActionName() const override { return TEXT("SetBlackboardKey"); }
+
+protected:
+    virtual void DeclareParams(FEAISActionParamSchema& Schema) const override;
 };
 
 /**
@@ -160,8 +247,11 @@ class P_EAIS_API UAIAction_InjectInput : public UAIAction
     GENERATED_BODY()
 
 public:
-    virtual void Execute_Implementation(UAIComponent* OwnerComponent, const FAIActionParams& Params) override;
+    virtual EAIActionStatus Execute_Implementation(UAIComponent* OwnerComponent, const FAIActionParams& Params) override;
     virtual FString GetActionName() const override { return TEXT("InjectInput"); }
+
+protected:
+    virtual void DeclareParams(FEAISActionParamSchema& Schema) const override;
 };
 
 /**
@@ -173,7 +263,7 @@ class P_EAIS_API UAIAction_PassToTeammate : public UAIAction
     GENERATED_BODY()
 
 public:
-    virtual void Execute_Implementation(UAIComponent* OwnerComponent, const FAIActionParams& Params) override;
+    virtual EAIActionStatus Execute_Implementation(UAIComponent* OwnerComponent, const FAIActionParams& Params) override;
     virtual FString GetActionName() const override { return TEXT("PassToTeammate"); }
 };
 
@@ -186,7 +276,7 @@ class P_EAIS_API UAIAction_LookAround : public UAIAction
     GENERATED_BODY()
 
 public:
-    virtual void Execute_Implementation(UAIComponent* OwnerComponent, const FAIActionParams& Params) override;
+    virtual EAIActionStatus Execute_Implementation(UAIComponent* OwnerComponent, const FAIActionParams& Params) override;
     virtual FString GetActionName() const override { return TEXT("LookAround"); }
 };
 
@@ -199,7 +289,23 @@ class P_EAIS_API UAIAction_Execute : public UAIAction
     GENERATED_BODY()
 
 public:
-    virtual void Execute_Implementation(UAIComponent* OwnerComponent, const FAIActionParams& Params) override;
+    virtual EAIActionStatus Execute_Implementation(UAIComponent* OwnerComponent, const FAIActionParams& Params) override;
     virtual FString GetActionName() const override { return TEXT("Execute"); }
 };
 
+/**
+ * RunQuery action - runs a scoring query from the behavior's "queries" (target = query name).
+ * Running until the subsystem writes the best candidate to the query's result key; Failed if nothing qualified.
+ */
+UCLASS(BlueprintType)
+class P_EAIS_API UAIAction_RunQuery : public UAIAction
+{
+    GENERATED_BODY()
+
+public:
+    virtual EAIActionStatus Execute_Implementation(UAIComponent* OwnerComponent, const FAIActionParams& Params) override;
+    virtual EAIActionStatus TickAction_Implementation(UAIComponent* OwnerComponent, const FAIActionParams& Params, float DeltaSeconds) override;
+    virtual void Abort_Implementation(UAIComponent* OwnerComponent) override;
+    virtual FString GetActionName() const override { return TEXT("RunQuery"); }
+};
+
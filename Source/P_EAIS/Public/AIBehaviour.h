@@ -9,8 +9,11 @@
 #include "CoreMinimal.h"
 #include "Engine/DataAsset.h"
 #include "EAIS_Types.h"
+#include "EAIS_Program.h"
 #include "AIBehaviour.generated.h"
 
+class FJsonObject;
+
 /**
  * Primary asset type for AI behaviors.
  * Can either embed JSON directly or reference an external JSON file.
@@ -55,6 +58,9 @@ public:
     UFUNCTION(BlueprintPure, Category = "AI Behavior")
     const FAIBehaviorDef& GetBehaviorDef() const { return ParsedBehavior; }
 
+    /** Get the compiled program shared by every interpreter running this behavior */
+    TSharedPtr<const FEAISCompiledProgram> GetCompiledProgram() const { return CompiledProgram; }
+
     /** Check if behavior is valid */
     UFUNCTION(BlueprintPure, Category = "AI Behavior")
     bool IsValid() const { return ParsedBehavior.bIsValid; }
@@ -63,6 +69,14 @@ public:
     UFUNCTION(BlueprintCallable, Category = "AI Behavior")
     bool ReloadFromFile(FString& OutError);
 
+    // ==================== JSON Helpers ====================
+
+    /** Parse one entry of a behavior's "queries" array (also used by the editor parsers so queries round-trip) */
+    static bool ParseQueryJson(const TSharedPtr<FJsonObject>& QueryObj, FEAISQueryDef& OutQuery);
+
+    /** Write a query in the format ParseQueryJson reads */
+    static TSharedRef<FJsonObject> QueryToJson(const FEAISQueryDef& Query);
+
     // ==================== Asset Interface ====================
 
     virtual FPrimaryAssetId GetPrimaryAssetId() const override;
@@ -74,4 +88,7 @@ public:
 protected:
     /** Parse JSON string into behavior definition */
     bool ParseJsonInternal(const FString& JsonString, FAIBehaviorDef& OutDef, FString& OutError);
+
+    /** Compiled form of ParsedBehavior (rebuilt on every successful parse) */
+    TSharedPtr<const FEAISCompiledProgram> CompiledProgram;
 };
@@ -13,6 +13,74 @@
 
 class UAIBehaviour;
 
+/**
+ * Native per-agent record of the last move request (used by UEAISSubsystem::RequestMove to coalesce requests)
+ */
+struct FEAISMoveRequestState
+{
+    /** Last requested goal */
+    FVector Goal = FVector::ZeroVector;
+
+    /** World time of the last request */
+    double RequestTime = 0.0;
+
+    /** Frame of the last request */
+    uint64 RequestFrame = 0;
+
+    /** Status of the last request (Running while path following is active) */
+    EAIActionStatus Status = EAIActionStatus::Failed;
+
+    /** Is there a request to compare against */
+    bool bHasGoal = false;
+
+    /** Waiting for an async path query (path following has not started yet) */
+    bool bPathPending = false;
+
+    void Reset() { *this = FEAISMoveRequestState(); }
+};
+
+/**
+ * Native per-agent record of the last scoring query request (see UEAISSubsystem::RequestScoringQuery)
+ */
+struct FEAISScoringRequestState
+{
+    /** Query index in the agent's program (INDEX_NONE = none) */
+    int32 QueryIndex = INDEX_NONE;
+
+    /** Serial of the latest request; results of older requests are dropped */
+    uint32 Serial = 0;
+
+    /** Running until the result is written */
+    EAIActionStatus Status = EAIActionStatus::Failed;
+
+    void Reset() { *this = FEAISScoringRequestState(); }
+};
+
+/**
+ * Cached IEAIS_TargetProvider result for one target of an agent
+ */
+struct FEAISTargetCacheEntry
+{
+    /** Target id passed to the provider */
+    FName TargetId;
+
+    /** Last resolved location */
+    FVector Location = FVector::ZeroVector;
+
+    /** World time / frame of the last resolve */
+    double ResolveTime = 0.0;
+    uint64 ResolveFrame = 0;
+
+    /** World time the target was last asked for (unused targets are dropped) */
+    double LastUsedTime = 0.0;
+
+    /** Did the provider resolve it */
+    bool bResolved = false;
+
+    /** Has it been resolved at all */
+    bool bValid = false;
+};
+
 /**
  * Component that attaches to a Pawn or Controller to provide AI functionality.
  * Holds the interpreter instance and blackboard.
@@ -43,6 +111,10 @@ public:
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "AI", meta = (ClampMin = "0.0"))
     float TickInterval = 0.0f;
 
+    /** Allow the subsystem scheduler to lower this agent's tick rate by distance (see EAIS Settings) */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "AI")
+    bool bAllowTickLOD = true;
+
     /** Auto-start on BeginPlay */
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "AI")
     bool bAutoStart = true;
@@ -54,8 +126,73 @@ public:
     // ==================== Component Lifecycle ====================
 
     virtual void BeginPlay() override;
+    virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
     virtual void TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction) override;
 
+    // ==================== Scheduling ====================
+
+    /** Should the AI tick this frame (running and allowed by RunMode) */
+    bool CanTickAI() const { return bIsRunning && ShouldRun(); }
+
+    /** Accumulate frame time toward the next AI tick */
+    void AccumulateTickTime(float DeltaTime) { TimeSinceLastTick += DeltaTime; }
+
+    /** Has enough time accumulated for the effective tick interval (or was a wake requested) */
+    bool IsTickDue() const { return bWakeRequested || TimeSinceLastTick >= GetEffectiveTickInterval(); }
+
+    /** Was an immediate tick requested (urgent event) */
+    bool IsWakeRequested() const { return bWakeRequested; }
+
+    /** Take the accumulated time for a tick (skipped frames included, so Timer conditions stay exact) */
+    float ConsumeTickTime();
+
+    /** Time accumulated toward the next AI tick */
+    float GetAccumulatedTickTime() const { return TimeSinceLastTick; }
+
+    /** Fixed step length for this agent: the base step stretched to a whole multiple covering the effective tick interval */
+    float GetFixedStepSeconds(float BaseStepSeconds) const;
+
+    /** Take as many whole fixed steps as have accumulated (at most MaxSteps; any backlog beyond that is dropped). A wake borrows one step. */
+    int32 ConsumeFixedSteps(float StepSeconds, int32 MaxSteps);
+
+    /** Record that the scheduler's frame budget pushed a due tick to the next frame. Returns consecutive deferrals. */
+    int32 MarkTickDeferred() { return ++DeferredTickFrames; }
+
+    /** Set the interval imposed by the scheduler's distance LOD (0 = no limit) */
+    void SetLODTickInterval(float Interval) { LODTickInterval = Interval; }
+
+    /** Current LOD interval imposed by the scheduler */
+    UFUNCTION(BlueprintPure, Category = "AI")
+    float GetLODTickInterval() const { return LODTickInterval; }
+
+    /** Interval actually used for ticking: the larger of TickInterval and the LOD interval */
+    float GetEffectiveTickInterval() const { return FMath::Max(TickInterval, LODTickInterval); }
+
+    /** Tick the interpreter with an already accumulated delta */
+    void TickAI(float DeltaSeconds);
+
+    /** Report coalesced blackboard changes to observers (once per frame, after the last TickAI) */
+    void DispatchBlackboardChanges() { Interpreter.DispatchBlackboardChanges(); }
+
+    /** Direct interpreter access for the subsystem scheduler */
+    FAIInterpreter& GetInterpreter() { return Interpreter; }
+
+    /** Last move request of this agent */
+    FEAISMoveRequestState& GetMoveState() { return MoveState; }
+
+    /** Last scoring query request of this agent */
+    FEAISScoringRequestState& GetScoringState() { return ScoringState; }
+
+    /** Owner or owner component implementing IEAIS_ActionExecutor (cached while it lives; call InvalidateActionExecutor after swapping executors) */
+    UObject* GetActionExecutor();
+
+    /** Forget the cached action executor so the next action resolves it again */
+    UFUNCTION(BlueprintCallable, Category = "AI")
+    void InvalidateActionExecutor() { CachedActionExecutor.Reset(); }
+
+    /** Resolve a target through the owner pawn's IEAIS_TargetProvider, cached per agent (see UEAISSettings::TargetCacheTTL) */
+    bool ResolveProviderTarget(FName TargetId, FVector& OutLocation);
+
     // ==================== Control ====================
 
     /** Initialize the AI with a behavior */
@@ -86,9 +223,17 @@ public:
     UFUNCTION(BlueprintCallable, Category = "AI")
     void EnqueueEvent(const FString& EventName, const FAIEventPayload& Payload);
 
-    /** Enqueue a simple event (no payload) */
+    /** Enqueue a simple event (no payload). Urgent events wake the agent regardless of its tick interval. */
+    UFUNCTION(BlueprintCallable, Category = "AI")
+    void EnqueueSimpleEvent(const FString& EventName, bool bUrgent = false);
+
+    /** Enqueue the event an input action is mapped to in [EAIS.InputMapping]. False if the action is unmapped. */
+    UFUNCTION(BlueprintCallable, Category = "AI|Input")
+    bool HandleInputAction(FName InputAction, bool bUrgent = false);
+
+    /** Tick this agent in the current or next frame regardless of its tick interval and LOD */
     UFUNCTION(BlueprintCallable, Category = "AI")
-    void EnqueueSimpleEvent(const FString& EventName);
+    void RequestWake() { bWakeRequested = true; }
 
     // ==================== Blackboard Access ====================
 
@@ -132,6 +277,64 @@ public:
     UFUNCTION(BlueprintPure, Category = "AI|Blackboard")
     UObject* GetBlackboardObject(const FString& Key) const;
 
+    // ==================== Blackboard Key Handles ====================
+
+    /** Resolve a key handle against this agent's behavior. Keep the result and reuse it for every agent on that behavior. */
+    UFUNCTION(BlueprintCallable, Category = "AI|Blackboard")
+    bool ResolveBlackboardKey(UPARAM(ref) FEAISBlackboardKeyHandle& Handle) const;
+
+    /** Make and resolve a key handle */
+    UFUNCTION(BlueprintCallable, Category = "AI|Blackboard")
+    FEAISBlackboardKeyHandle MakeBlackboardKeyHandle(const FString& Key, EBlackboardValueType Type) const;
+
+    /** Set a bool through a handle */
+    UFUNCTION(BlueprintCallable, Category = "AI|Blackboard")
+    void SetBlackboardBoolByHandle(const FEAISBlackboardKeyHandle& Handle, bool Value) { Interpreter.SetBlackboardBool(Handle, Value); }
+
+    /** Get a bool through a handle */
+    UFUNCTION(BlueprintPure, Category = "AI|Blackboard")
+    bool GetBlackboardBoolByHandle(const FEAISBlackboardKeyHandle& Handle) const { return Interpreter.GetBlackboardBool(Handle); }
+
+    /** Set an int through a handle */
+    UFUNCTION(BlueprintCallable, Category = "AI|Blackboard")
+    void SetBlackboardIntByHandle(const FEAISBlackboardKeyHandle& Handle, int32 Value) { Interpreter.SetBlackboardInt(Handle, Value); }
+
+    /** Get an int through a handle */
+    UFUNCTION(BlueprintPure, Category = "AI|Blackboard")
+    int32 GetBlackboardIntByHandle(const FEAISBlackboardKeyHandle& Handle) const { return Interpreter.GetBlackboardInt(Handle); }
+
+    /** Set a float through a handle */
+    UFUNCTION(BlueprintCallable, Category = "AI|Blackboard")
+    void SetBlackboardFloatByHandle(const FEAISBlackboardKeyHandle& Handle, float Value) { Interpreter.SetBlackboardFloat(Handle, Value); }
+
+    /** Get a float through a handle */
+    UFUNCTION(BlueprintPure, Category = "AI|Blackboard")
+    float GetBlackboardFloatByHandle(const FEAISBlackboardKeyHandle& Handle) const { return Interpreter.GetBlackboardFloat(Handle); }
+
+    /** Set a vector through a handle */
+    UFUNCTION(BlueprintCallable, Category = "AI|Blackboard")
+    void SetBlackboardVectorByHandle(const FEAISBlackboardKeyHandle& Handle, const FVector& Value) { Interpreter.SetBlackboardVector(Handle, Value); }
+
+    /** Get a vector through a handle */
+    UFUNCTION(BlueprintPure, Category = "AI|Blackboard")
+    FVector GetBlackboardVectorByHandle(const FEAISBlackboardKeyHandle& Handle) const { return Interpreter.GetBlackboardVector(Handle); }
+
+    /** Set an object through a handle */
+    UFUNCTION(BlueprintCallable, Category = "AI|Blackboard")
+    void SetBlackboardObjectByHandle(const FEAISBlackboardKeyHandle& Handle, UObject* Value) { Interpreter.SetBlackboardObject(Handle, Value); }
+
+    /** Get an object through a handle */
+    UFUNCTION(BlueprintPure, Category = "AI|Blackboard")
+    UObject* GetBlackboardObjectByHandle(const FEAISBlackboardKeyHandle& Handle) const { return Interpreter.GetBlackboardObject(Handle); }
+
+    /** Call OnChanged when Key changes. Changes are coalesced and reported once per frame after the AI ticks. */
+    UFUNCTION(BlueprintCallable, Category = "AI|Blackboard")
+    void ObserveBlackboardKey(const FString& Key, FOnAIBlackboardKeyChanged OnChanged);
+
+    /** Remove the observers Listener bound to Key (every key if Key is empty) */
+    UFUNCTION(BlueprintCallable, Category = "AI|Blackboard")
+    void StopObservingBlackboard(UObject* Listener, const FString& Key = TEXT(""));
+
     // ==================== State Information ====================
 
     /** Get current state ID */
@@ -170,27 +373,81 @@ public:
 
     // ==================== Delegates ====================
 
-    /** Called when AI state changes */
+    /** Called when AI state changes (state ids are only built when this is bound; native code should use GetOnStateChanged) */
     UPROPERTY(BlueprintAssignable, Category = "AI|Events")
     FOnAIStateChanged OnStateChanged;
 
-    /** Called when AI executes an action */
+    /** Called when AI executes an action (params are only copied when this is bound; native code should use GetOnActionExecuted) */
     UPROPERTY(BlueprintAssignable, Category = "AI|Events")
     FOnAIActionExecuted OnActionExecuted;
 
+    /** Native state change delegate carrying state indices and names */
+    FOnEAISStateChanged& GetOnStateChanged() { return Interpreter.OnStateChanged; }
+
+    /** Native action delegate carrying the program's action entry by reference */
+    FOnEAISActionExecuted& GetOnActionExecuted() { return Interpreter.OnActionExecuted; }
+
+    /** Native delegate for each event the interpreter processes */
+    FOnEAISEventReceived& GetOnEventReceived() { return Interpreter.OnEventReceived; }
+
+    /** Native delegate fired when the component ends play (before its interpreter is released) */
+    FSimpleMulticastDelegate& GetOnEndPlay() { return OnEndPlayNative; }
+
 protected:
     /** The interpreter instance */
     FAIInterpreter Interpreter;
 
+    /** Listeners for GetOnEndPlay */
+    FSimpleMulticastDelegate OnEndPlayNative;
+
     /** Is the AI currently running */
     bool bIsRunning = false;
 
     /** Time since last tick */
     float TimeSinceLastTick = 0.0f;
 
-    /** Internal state change handler */
+    /** Interval imposed by the scheduler's distance LOD */
+    float LODTickInterval = 0.0f;
+
+    /** Tick as soon as possible regardless of interval (set by urgent events) */
+    bool bWakeRequested = false;
+
+    /** Consecutive frames a due tick was deferred by the scheduler's frame budget */
+    int32 DeferredTickFrames = 0;
+
+    /** Is this component ticked by the subsystem scheduler */
+    bool bScheduledBySubsystem = false;
+
+    /** Pawn registered for subsystem team queries (follows possession when the owner is a controller) */
+    TWeakObjectPtr<AActor> QueryActor;
+
+    /** Register the owner pawn for team queries and bind its team's shared blackboard, replacing the previous pawn */
+    void UpdateQueryActor();
+
+    /** Controller owners possess their pawn after BeginPlay and may change pawns later */
     UFUNCTION()
-    void HandleStateChanged(const FString& OldState, const FString& NewState);
+    void HandlePossessedPawnChanged(APawn* OldPawn, APawn* NewPawn);
+
+    /** Last move request (see UEAISSubsystem::RequestMove) */
+    FEAISMoveRequestState MoveState;
+
+    /** Last scoring query request (see UEAISSubsystem::RequestScoringQuery) */
+    FEAISScoringRequestState ScoringState;
+
+    /** Cached IEAIS_ActionExecutor (null until one is found) */
+    TWeakObjectPtr<UObject> CachedActionExecutor;
+
+    /** Target-provider results, refreshed together when one goes stale */
+    TArray<FEAISTargetCacheEntry, TInlineAllocator<4>> TargetCache;
+
+    /** Drop unused targets and re-resolve the rest with one EAIS_GetTargetLocations call */
+    void RefreshTargetCache(APawn* Pawn, double Now);
+
+    /** Internal state change handler */
+    void HandleStateChanged(const FEAISStateChange& Change);
+
+    /** Forwards actions to the Blueprint delegate when it is bound */
+    void HandleActionExecuted(const FAIActionEntry& Entry);
 
     /** Check if we should run based on RunMode and net role */
     bool ShouldRun() const;
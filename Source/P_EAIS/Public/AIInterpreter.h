@@ -8,12 +8,71 @@
 
 #include "CoreMinimal.h"
 #include "EAIS_Types.h"
+#include "EAIS_Program.h"
 #include "AIInterpreter.generated.h"
 
 class UAIComponent;
 class UAIAction;
 class UEAISSubsystem;
 
+/**
+ * Status of one action entry started in the current state (per agent).
+ */
+struct FEAISActionRecord
+{
+    /** Entry in the program's state definition */
+    const FAIActionEntry* Entry = nullptr;
+
+    /** Shared action instance */
+    TWeakObjectPtr<UAIAction> Action;
+
+    /** Last reported status */
+    EAIActionStatus Status = EAIActionStatus::Succeeded;
+
+    /** Finished since OnTick last ran, so OnTick waits a tick before restarting it */
+    bool bJustFinished = false;
+};
+
+/**
+ * Observers of one blackboard key of one agent.
+ */
+struct FEAISBlackboardObserver
+{
+    /** Observed key as given */
+    FString Key;
+
+    /** Agent slot of the key (INDEX_NONE for team/global keys, which are compared every dispatch) */
+    int32 Slot = INDEX_NONE;
+
+    /** Bound observers */
+    FOnEAISBlackboardChanged Delegate;
+
+    /** Value last reported (or seen when the observer was added) */
+    FBlackboardValue LastValue;
+
+    /** Was the key set when last reported */
+    bool bHadValue = false;
+
+    /** Written since the last dispatch */
+    bool bDirty = false;
+};
+
+/**
+ * Column scratch for FAIInterpreter::SelectTransitionsBatch. Owned by the caller and reused across
+ * batches so the columns keep their allocations; one instance must not be shared between threads.
+ */
+struct P_EAIS_API FEAISTransitionBatchScratch
+{
+    TArray<float> Lhs;
+    TArray<float> Rhs;
+    TArray<uint8> Mask;
+    TArray<uint8> Scalar;
+    TArray<double> AX, AY, AZ, BX, BY, BZ;
+
+    /** Size every column to Num lanes without shrinking */
+    void SetNum(int32 Num);
+};
+
 /**
  * Runtime interpreter for AI state machines.
  * Parses JSON behavior definitions and executes states/transitions.
@@ -34,12 +93,21 @@ public:
     /** Load behavior from parsed definition */
     bool LoadFromDef(const FAIBehaviorDef& BehaviorDef);
 
+    /** Load an already compiled program (shared between agents running the same profile) */
+    bool LoadFromProgram(const TSharedPtr<const FEAISCompiledProgram>& InProgram);
+
     /** Initialize the interpreter with an owner component */
     void Initialize(UAIComponent* OwnerComp);
 
     /** Reset to initial state */
     void Reset();
 
+    /**
+     * Take Other's program and storage (keeping this interpreter's delegates, observers and shared blackboards).
+     * Running actions of both are aborted; Other is left without a program. Call Initialize afterwards.
+     */
+    void TakeProgramStorage(FAIInterpreter& Other);
+
     // ==================== Runtime ====================
 
     /** Tick the interpreter */
@@ -48,6 +116,9 @@ public:
     /** Enqueue an event for processing */
     void EnqueueEvent(const FString& EventName, const FAIEventPayload& Payload);
 
+    /** Enqueue an interned program event without a payload (no name lookup; used by input routing) */
+    void EnqueueEventId(int32 EventId);
+
     /** Force transition to a specific state */
     bool ForceTransition(const FString& StateId);
 
@@ -60,6 +131,45 @@ public:
     /** Step one tick (for debugging) */
     void StepTick();
 
+    // ==================== Latent Actions ====================
+
+    /**
+     * Finish the running entry of Action whose params are Params (the entry's own params, or a copy of them
+     * as Blueprint passes them). Entries are told apart by params since one action instance serves every entry.
+     */
+    bool FinishRunningAction(const UAIAction* Action, const FAIActionParams& Params, EAIActionStatus Status);
+
+    /** Abort every running action of the current state */
+    void AbortRunningActions();
+
+    /** Number of actions still running in the current state */
+    int32 GetNumRunningActions() const;
+
+    // ==================== Split Tick (scheduler) ====================
+    // Tick() == BeginTick() + SelectTransition() + EndTick(). The subsystem scheduler
+    // runs the phases separately so transition selection can be batched across agents.
+
+    /** Update timers, process events, tick running actions and run OnTick actions. Returns false if nothing else should run this tick. */
+    bool BeginTick(float DeltaSeconds);
+
+    /** Pick the first passing transition of the current state (rank into the compiled state), or INDEX_NONE */
+    int32 SelectTransition() const;
+
+    /** Apply the selected transition (chaining up to MaxTransitionsPerTick) and clear this tick's events */
+    void EndTick(int32 TransitionRank);
+
+    /**
+     * EndTick for a rank selected while in SelectedState of SelectedProgram. If either changed since
+     * (another agent forced or re-initialized this one), the transition is selected again.
+     */
+    void EndTick(int32 TransitionRank, const FEAISCompiledProgram* SelectedProgram, int32 SelectedState);
+
+    /**
+     * Select transitions for a batch of interpreters that share a program and current state.
+     * Simple float/bool/distance/timer conditions are evaluated column-wise over the batch, in Scratch.
+     */
+    static void SelectTransitionsBatch(TArrayView<FAIInterpreter* const> Batch, TArrayView<int32> OutTransitionRanks, FEAISTransitionBatchScratch& Scratch);
+
     // ==================== Blackboard ====================
 
     /** Set a blackboard value */
@@ -92,16 +202,63 @@ public:
     /** Get blackboard object */
     UObject* GetBlackboardObject(const FString& Key) const;
 
+    // ==================== Blackboard Key Handles ====================
+
+    /** Resolve a handle to a program slot. False if the behavior does not declare the key or its default has another type. */
+    bool ResolveKeyHandle(FEAISBlackboardKeyHandle& Handle) const;
+
+    /** Typed access through a handle (unresolved handles, or keys the behavior does not declare, fall back to the key) */
+    void SetBlackboardBool(const FEAISBlackboardKeyHandle& Handle, bool Value);
+    void SetBlackboardInt(const FEAISBlackboardKeyHandle& Handle, int32 Value);
+    void SetBlackboardFloat(const FEAISBlackboardKeyHandle& Handle, float Value);
+    void SetBlackboardVector(const FEAISBlackboardKeyHandle& Handle, const FVector& Value);
+    void SetBlackboardObject(const FEAISBlackboardKeyHandle& Handle, UObject* Value);
+    bool GetBlackboardBool(const FEAISBlackboardKeyHandle& Handle) const;
+    int32 GetBlackboardInt(const FEAISBlackboardKeyHandle& Handle) const;
+    float GetBlackboardFloat(const FEAISBlackboardKeyHandle& Handle) const;
+    FVector GetBlackboardVector(const FEAISBlackboardKeyHandle& Handle) const;
+    UObject* GetBlackboardObject(const FEAISBlackboardKeyHandle& Handle) const;
+
+    /** Observe a key. Changes are coalesced and reported by DispatchBlackboardChanges; the current value is not reported. */
+    FDelegateHandle ObserveBlackboardKey(const FString& Key, FOnEAISBlackboardChanged::FDelegate&& Delegate);
+
+    /** Remove one observer of a key */
+    void RemoveBlackboardObserver(const FString& Key, FDelegateHandle Handle);
+
+    /** Remove every observer bound to UserObject (of Key only, if given) */
+    void RemoveBlackboardObservers(const void* UserObject, const FString& Key = FString());
+
+    /** Report observed keys whose value differs from the last report (called once per frame after the agent ticks) */
+    void DispatchBlackboardChanges();
+
+    /** Point "team."/"global." keys at shared blackboards (seeding their defaults if missing) */
+    void BindSharedBlackboards(const TSharedPtr<FEAISSharedBlackboard>& InTeam, const TSharedPtr<FEAISSharedBlackboard>& InGlobal);
+
+    /** Resolve a slot holding a vector or actor to a location. False if the slot is unset or holds neither. */
+    bool GetBlackboardLocation(int32 Slot, FVector& OutLocation) const;
+
+    /** Resolve a key holding a vector or actor to a location. False if the key is unset or holds neither. */
+    bool GetBlackboardLocation(const FString& Key, FVector& OutLocation) const;
+
     // ==================== State Information ====================
 
     /** Get current state ID */
-    FString GetCurrentStateId() const { return CurrentStateId; }
+    FString GetCurrentStateId() const { return CurrentStateIndex != INDEX_NONE ? Program->Def.States[CurrentStateIndex].Id : FString(); }
+
+    /** Get current state ID as an interned name (no string copy) */
+    FName GetCurrentStateName() const { return CurrentStateIndex != INDEX_NONE ? Program->StateNames[CurrentStateIndex] : NAME_None; }
+
+    /** Get current state index in the compiled program */
+    int32 GetCurrentStateIndex() const { return CurrentStateIndex; }
 
     /** Get behavior name */
-    FString GetBehaviorName() const { return BehaviorDef.Name; }
+    FString GetBehaviorName() const { return Program.IsValid() ? Program->Def.Name : FString(); }
+
+    /** Get the compiled program (shared) */
+    const TSharedPtr<const FEAISCompiledProgram>& GetProgram() const { return Program; }
 
     /** Is the interpreter valid and running? */
-    bool IsValid() const { return BehaviorDef.bIsValid && !CurrentStateId.IsEmpty(); }
+    bool IsValid() const { return Program.IsValid() && Program->Def.bIsValid && CurrentStateIndex != INDEX_NONE; }
 
     /** Get all state IDs */
     TArray<FString> GetAllStateIds() const;
@@ -117,34 +274,56 @@ public:
 
     // ==================== Delegates ====================
 
-    /** Called when state changes */
-    FOnAIStateChanged OnStateChanged;
+    /** Called when state changes (after the new state's OnEnter actions) */
+    FOnEAISStateChanged OnStateChanged;
 
     /** Called when an action is executed */
-    FOnAIActionExecuted OnActionExecuted;
+    FOnEAISActionExecuted OnActionExecuted;
+
+    /** Called for each queued event when the interpreter processes it (start of its tick) */
+    FOnEAISEventReceived OnEventReceived;
 
 private:
-    /** The loaded behavior definition */
-    FAIBehaviorDef BehaviorDef;
+    /** The compiled behavior (shared, immutable) */
+    TSharedPtr<const FEAISCompiledProgram> Program;
+
+    /** Current state index in the compiled program */
+    int32 CurrentStateIndex = INDEX_NONE;
+
+    /** Previous state index in the compiled program */
+    int32 PreviousStateIndex = INDEX_NONE;
+
+    /** Blackboard storage, indexed by slot (program slots first, then dynamic keys) */
+    TArray<FBlackboardValue> Blackboard;
+
+    /** Which slots currently hold a value */
+    TBitArray<> BlackboardSet;
 
-    /** Current state ID */
-    FString CurrentStateId;
+    /** Keys written at runtime that the program does not declare */
+    TMap<FString, int32> DynamicSlots;
 
-    /** Previous state ID */
-    FString PreviousStateId;
+    /** Shared blackboards backing "team." and "global." keys (owned by UEAISSubsystem) */
+    TSharedPtr<FEAISSharedBlackboard> TeamBlackboard;
+    TSharedPtr<FEAISSharedBlackboard> GlobalBlackboard;
 
-    /** Blackboard storage */
-    TMap<FString, FBlackboardValue> Blackboard;
+    /** Observed keys */
+    TArray<FEAISBlackboardObserver> Observers;
+
+    /** Slot -> observer index (INDEX_NONE if unobserved); may be shorter than Blackboard */
+    TArray<int32> ObserverBySlot;
 
     /** Event queue */
     TArray<FAIQueuedEvent> EventQueue;
 
-    /** Recently received events (for condition checking) */
-    TSet<FString> RecentEvents;
+    /** Event ids received this tick (for condition checking); events no condition references are not kept */
+    TArray<int32, TInlineAllocator<4>> RecentEventIds;
 
     /** Owner component */
     TWeakObjectPtr<UAIComponent> OwnerComponent;
 
+    /** Actions started by OnEnter/OnTick in the current state and their status */
+    TArray<FEAISActionRecord> ActionRecords;
+
     /** Elapsed time in current state */
     float StateElapsedTime = 0.0f;
 
@@ -157,26 +336,89 @@ private:
     /** Should step one tick */
     bool bShouldStep = false;
 
-    /** Timer tracking for timer conditions */
-    TMap<FString, float> TimerValues;
-
     // ==================== Internal Methods ====================
 
     /** Get state by ID */
     const FAIState* GetState(const FString& StateId) const;
 
-    /** Enter a state */
-    void EnterState(const FString& StateId);
+    /** Enter a state by index */
+    void EnterState(int32 StateIndex);
+
+    /** Transition to a state by index (exit + enter) */
+    void TransitionTo(int32 StateIndex);
+
+    /** Take a transition of the current state by rank. Returns false if nothing changed. */
+    bool ApplyTransition(int32 TransitionRank);
 
     /** Exit current state */
     void ExitState();
 
-    /** Execute actions */
-    void ExecuteActions(const TArray<FAIActionEntry>& Actions);
+    /** Execute actions. Tracked entries get a status record and are not restarted while running. */
+    void ExecuteActions(const TArray<FAIActionEntry>& Actions, bool bTrackStatus);
+
+    /** Tick the running actions of the current state */
+    void TickRunningActions(float DeltaSeconds);
+
+    /** Does any action named ActionName in the current state have a status in StatusMask? */
+    bool HasActionStatus(const FString& ActionName, uint8 StatusMask) const;
 
     /** Process queued events */
     void ProcessEvents();
 
     /** Clear recent events */
     void ClearRecentEvents();
+
+    /** Reset blackboard storage to the program's slot layout and prebaked defaults */
+    void ResetBlackboardLayout();
+
+    /** Write the program's team/global defaults where the shared blackboard lacks the key */
+    void ApplySharedDefaults();
+
+    /** Shared blackboard of a scope (null for Agent or when unbound) */
+    FEAISSharedBlackboard* GetSharedBlackboard(EEAISBlackboardScope Scope) const;
+
+    /** Find the slot for a key (program or dynamic), INDEX_NONE if unknown */
+    int32 FindSlot(const FString& Key) const;
+
+    /** Find the slot for an agent key, adding an unset dynamic slot if unknown */
+    int32 FindOrAddSlot(const FString& Key);
+
+    /** Slot of a handle in this interpreter's program (looked up by key if it was resolved elsewhere) */
+    int32 GetHandleSlot(const FEAISBlackboardKeyHandle& Handle) const;
+
+    /** Storage of a handle's slot, marked set and typed for writing (null if the key is not a program slot, or its declared type differs from Type) */
+    FBlackboardValue* GetWritableValue(const FEAISBlackboardKeyHandle& Handle, EBlackboardValueType Type);
+
+    /** Flag the observer of a slot (if any) for the next dispatch */
+    FORCEINLINE void MarkSlotChanged(int32 Slot)
+    {
+        if (ObserverBySlot.IsValidIndex(Slot) && ObserverBySlot[Slot] != INDEX_NONE)
+        {
+            Observers[ObserverBySlot[Slot]].bDirty = true;
+        }
+    }
+
+    /** Resolve observer slots after the slot layout changed or observers were removed */
+    void RebindObservers();
+
+    /** Current value of an observed key (null if unset) */
+    const FBlackboardValue* FindObservedValue(const FEAISBlackboardObserver& Observer) const;
+
+    /** Get the value in a slot if it is set */
+    const FBlackboardValue* GetSlotValue(int32 Slot) const;
+
+    /** Value of a key if it is set, including shared keys the program does not reference */
+    const FBlackboardValue* FindValue(const FString& Key) const;
+
+    /** Lowest-rank event-gated transition for this tick's events that beats BoundRank (INDEX_NONE = unbounded) */
+    int32 SelectEventTransition(int32 BoundRank) const;
+
+    /** Evaluate a compiled condition */
+    bool EvaluateCompiledCondition(int32 ConditionIndex) const;
+
+    /** Resolve a blackboard slot holding a vector or actor to a location (zero if unset) */
+    FVector GetSlotLocation(int32 Slot) const;
+
+    /** Get the owner actor's location */
+    bool GetOwnerLocation(FVector& OutLocation) const;
 };
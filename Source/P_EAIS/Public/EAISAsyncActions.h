@@ -0,0 +1,170 @@
+/*
+ * @Author: Punal Manalan
+ * @Description: Blueprint async nodes that wait on an AI component (state, blackboard value, event) without polling
+ * @Date: 18/10/2026
+ */
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Kismet/BlueprintAsyncActionBase.h"
+#include "Engine/EngineTypes.h"
+#include "EAIS_Types.h"
+#include "EAISAsyncActions.generated.h"
+
+class UAIComponent;
+
+DECLARE_DYNAMIC_MULTICAST_DELEGATE(FEAISWaitForStatePin);
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FEAISWaitForBlackboardPin, const FBlackboardValue&, Value);
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FEAISWaitForEventPin, const FAIEventPayload&, Payload);
+
+/**
+ * Base for EAIS wait nodes: binds to the component's native delegates on Activate,
+ * unbinds on completion and optionally times out. Fails when the component ends play.
+ */
+UCLASS(Abstract)
+class P_EAIS_API UEAISAsyncWaitBase : public UBlueprintAsyncActionBase
+{
+    GENERATED_BODY()
+
+public:
+    virtual void Activate() override;
+
+protected:
+    /** Component being waited on */
+    TWeakObjectPtr<UAIComponent> Component;
+
+    /** Seconds before giving up (0 = never) */
+    float TimeoutSeconds = 0.0f;
+
+    /** Complete at once if the condition already holds on Activate */
+    bool bCompleteIfAlready = true;
+
+    /** Bind to the component. Return true if the condition already holds. */
+    virtual bool StartWaiting(UAIComponent& AIComponent) PURE_VIRTUAL(UEAISAsyncWaitBase::StartWaiting, return false;);
+
+    /** Unbind from the component */
+    virtual void StopWaiting(UAIComponent& AIComponent) PURE_VIRTUAL(UEAISAsyncWaitBase::StopWaiting, );
+
+    /** Fire the success pin */
+    virtual void BroadcastCompleted() PURE_VIRTUAL(UEAISAsyncWaitBase::BroadcastCompleted, );
+
+    /** Fire the failure pin (timeout, missing component or component end of play) */
+    virtual void BroadcastFailed() PURE_VIRTUAL(UEAISAsyncWaitBase::BroadcastFailed, );
+
+    /** Unbind, fire one pin and release the node */
+    void Finish(bool bSucceeded);
+
+private:
+    FTimerHandle TimeoutHandle;
+
+    bool bFinished = false;
+
+    void HandleTimeout();
+
+    /** The component ended play or was destroyed: the condition can no longer be reached */
+    void HandleComponentEndPlay();
+};
+
+/**
+ * Wait until an AI component enters a state.
+ */
+UCLASS()
+class P_EAIS_API UEAISAsyncWaitForState : public UEAISAsyncWaitBase
+{
+    GENERATED_BODY()
+
+public:
+    /** Entered the state (or was already in it) */
+    UPROPERTY(BlueprintAssignable)
+    FEAISWaitForStatePin OnReached;
+
+    /** Timed out, or the component was missing or ended play */
+    UPROPERTY(BlueprintAssignable)
+    FEAISWaitForStatePin OnFailed;
+
+    /** Wait for the AI to enter StateId (TimeoutSeconds 0 = wait forever) */
+    UFUNCTION(BlueprintCallable, Category = "AI|Async", meta = (BlueprintInternalUseOnly = "true", DisplayName = "Wait For AI State"))
+    static UEAISAsyncWaitForState* WaitForState(UAIComponent* AIComponent, const FString& StateId, float TimeoutSeconds = 0.0f, bool bCompleteIfAlreadyInState = true);
+
+protected:
+    virtual bool StartWaiting(UAIComponent& AIComponent) override;
+    virtual void StopWaiting(UAIComponent& AIComponent) override;
+    virtual void BroadcastCompleted() override { OnReached.Broadcast(); }
+    virtual void BroadcastFailed() override { OnFailed.Broadcast(); }
+
+private:
+    FName StateName;
+
+    void HandleStateChanged(const FEAISStateChange& Change);
+};
+
+/**
+ * Wait until a blackboard key of an AI component holds a value.
+ */
+UCLASS()
+class P_EAIS_API UEAISAsyncWaitForBlackboardValue : public UEAISAsyncWaitBase
+{
+    GENERATED_BODY()
+
+public:
+    /** The key holds the value */
+    UPROPERTY(BlueprintAssignable)
+    FEAISWaitForBlackboardPin OnMatched;
+
+    /** Timed out, or the component was missing or ended play (Value is the key's last value) */
+    UPROPERTY(BlueprintAssignable)
+    FEAISWaitForBlackboardPin OnFailed;
+
+    /** Wait for Key to equal Value (same type; checked when blackboard changes are dispatched after the AI ticks) */
+    UFUNCTION(BlueprintCallable, Category = "AI|Async", meta = (BlueprintInternalUseOnly = "true", DisplayName = "Wait For AI Blackboard Value"))
+    static UEAISAsyncWaitForBlackboardValue* WaitForBlackboardValue(UAIComponent* AIComponent, const FString& Key, const FBlackboardValue& Value, float TimeoutSeconds = 0.0f, bool bCompleteIfAlreadyMatching = true);
+
+protected:
+    virtual bool StartWaiting(UAIComponent& AIComponent) override;
+    virtual void StopWaiting(UAIComponent& AIComponent) override;
+    virtual void BroadcastCompleted() override { OnMatched.Broadcast(LastValue); }
+    virtual void BroadcastFailed() override { OnFailed.Broadcast(LastValue); }
+
+private:
+    FString Key;
+    FBlackboardValue Expected;
+    FBlackboardValue LastValue;
+
+    bool Matches(const FBlackboardValue& Value) const;
+    void HandleValueChanged(const FString& ChangedKey, const FBlackboardValue& Value);
+};
+
+/**
+ * Wait until an AI component processes an event.
+ */
+UCLASS()
+class P_EAIS_API UEAISAsyncWaitForEvent : public UEAISAsyncWaitBase
+{
+    GENERATED_BODY()
+
+public:
+    /** The event was processed by the AI */
+    UPROPERTY(BlueprintAssignable)
+    FEAISWaitForEventPin OnReceived;
+
+    /** Timed out, or the component was missing or ended play */
+    UPROPERTY(BlueprintAssignable)
+    FEAISWaitForEventPin OnFailed;
+
+    /** Wait for the AI to process EventName (on its next tick after the event is enqueued) */
+    UFUNCTION(BlueprintCallable, Category = "AI|Async", meta = (BlueprintInternalUseOnly = "true", DisplayName = "Wait For AI Event"))
+    static UEAISAsyncWaitForEvent* WaitForEvent(UAIComponent* AIComponent, const FString& EventName, float TimeoutSeconds = 0.0f);
+
+protected:
+    virtual bool StartWaiting(UAIComponent& AIComponent) override;
+    virtual void StopWaiting(UAIComponent& AIComponent) override;
+    virtual void BroadcastCompleted() override { OnReceived.Broadcast(Payload); }
+    virtual void BroadcastFailed() override { OnFailed.Broadcast(Payload); }
+
+private:
+    FString EventName;
+    FAIEventPayload Payload;
+
+    void HandleEventReceived(const FString& ReceivedEvent, const FAIEventPayload& ReceivedPayload);
+};
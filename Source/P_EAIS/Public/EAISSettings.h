@@ -26,4 +26,88 @@ public:
     /** Enables additional EAIS logging (when code checks this setting). */
     UPROPERTY(Config, EditAnywhere, Category="EAIS|Debug")
     bool bEnableDebugLogs = false;
+
+    /** Tick AI components from the EAIS subsystem scheduler instead of per-component ticks. */
+    UPROPERTY(Config, EditAnywhere, Category="Scheduler")
+    bool bUseAgentScheduler = true;
+
+    /** Group scheduled agents by (program, state) and evaluate their transitions in batches. */
+    UPROPERTY(Config, EditAnywhere, Category="Scheduler", meta=(EditCondition="bUseAgentScheduler"))
+    bool bBatchTransitionEvaluation = true;
+
+    /** Step interpreters at a fixed rate with an accumulator, making timers independent of frame rate and hitches. */
+    UPROPERTY(Config, EditAnywhere, Category="Scheduler|Fixed Timestep")
+    bool bUseFixedTimestep = false;
+
+    /** Fixed interpreter step rate in Hz. */
+    UPROPERTY(Config, EditAnywhere, Category="Scheduler|Fixed Timestep", meta=(EditCondition="bUseFixedTimestep", ClampMin="1.0"))
+    float FixedTickRate = 20.0f;
+
+    /** Maximum steps per agent per frame; time beyond this after a hitch is dropped. */
+    UPROPERTY(Config, EditAnywhere, Category="Scheduler|Fixed Timestep", meta=(EditCondition="bUseFixedTimestep", ClampMin="1"))
+    int32 MaxSubstepsPerFrame = 4;
+
+    /** Per-frame time budget for scheduled AI ticks in milliseconds (0 = unlimited). Agents over budget run first next frame. */
+    UPROPERTY(Config, EditAnywhere, Category="Scheduler|Budget", meta=(EditCondition="bUseAgentScheduler", ClampMin="0.0", Units="ms"))
+    float FrameBudgetMs = 0.0f;
+
+    /** Log a warning when an agent's tick has been deferred by the budget this many frames in a row (0 = never). */
+    UPROPERTY(Config, EditAnywhere, Category="Scheduler|Budget", meta=(EditCondition="bUseAgentScheduler", ClampMin="0"))
+    int32 StarvationWarningFrames = 30;
+
+    /** Scale each scheduled agent's tick rate by its distance to players and focus actors. */
+    UPROPERTY(Config, EditAnywhere, Category="Scheduler|LOD", meta=(EditCondition="bUseAgentScheduler"))
+    bool bEnableDistanceLOD = false;
+
+    /** Agents closer than this to a focus point tick at LODNearTickRate. */
+    UPROPERTY(Config, EditAnywhere, Category="Scheduler|LOD", meta=(EditCondition="bEnableDistanceLOD", ClampMin="0.0", Units="cm"))
+    float LODNearDistance = 2000.0f;
+
+    /** Agents farther than this from every focus point tick at LODFarTickRate. Rates are interpolated in between. */
+    UPROPERTY(Config, EditAnywhere, Category="Scheduler|LOD", meta=(EditCondition="bEnableDistanceLOD", ClampMin="0.0", Units="cm"))
+    float LODFarDistance = 8000.0f;
+
+    /** Tick rate (Hz) near the action (0 = every frame). */
+    UPROPERTY(Config, EditAnywhere, Category="Scheduler|LOD", meta=(EditCondition="bEnableDistanceLOD", ClampMin="0.0"))
+    float LODNearTickRate = 60.0f;
+
+    /** Tick rate (Hz) far from the action. */
+    UPROPERTY(Config, EditAnywhere, Category="Scheduler|LOD", meta=(EditCondition="bEnableDistanceLOD", ClampMin="0.1"))
+    float LODFarTickRate = 5.0f;
+
+    /** Actors with this tag are focus points in addition to human player pawns (None = players only). */
+    UPROPERTY(Config, EditAnywhere, Category="Scheduler|LOD", meta=(EditCondition="bEnableDistanceLOD"))
+    FName LODFocusActorTag = TEXT("Ball");
+
+    /** Agents not net relevant to any player tick at LODFarTickRate regardless of distance. */
+    UPROPERTY(Config, EditAnywhere, Category="Scheduler|LOD", meta=(EditCondition="bEnableDistanceLOD"))
+    bool bLODUseNetRelevancy = false;
+
+    /** How often (seconds) agent LOD levels are recomputed. */
+    UPROPERTY(Config, EditAnywhere, Category="Scheduler|LOD", meta=(EditCondition="bEnableDistanceLOD", ClampMin="0.0"))
+    float LODUpdateInterval = 0.25f;
+
+    /** Collect MoveTo requests per frame and resolve them with async path queries (paths are applied the next frame). */
+    UPROPERTY(Config, EditAnywhere, Category="Pathfinding")
+    bool bAsyncPathfinding = true;
+
+    /** Path queries dispatched per frame; the rest wait for the next frame. */
+    UPROPERTY(Config, EditAnywhere, Category="Pathfinding", meta=(EditCondition="bAsyncPathfinding", ClampMin="1"))
+    int32 MaxPathQueriesPerFrame = 8;
+
+    /** Agents whose start and goal fall in the same cell of this size share one path query (0 = never share). */
+    UPROPERTY(Config, EditAnywhere, Category="Pathfinding", meta=(EditCondition="bAsyncPathfinding", ClampMin="0.0", Units="cm"))
+    float PathQueryShareDistance = 100.0f;
+
+    /** Scoring queries (RunQuery) dispatched per frame; the rest wait for the next frame. */
+    UPROPERTY(Config, EditAnywhere, Category="Targets", meta=(ClampMin="1"))
+    int32 MaxScoringQueriesPerFrame = 16;
+
+    /** Seconds an agent reuses an IEAIS_TargetProvider result (0 = resolve once per frame). */
+    UPROPERTY(Config, EditAnywhere, Category="Targets", meta=(ClampMin="0.0", Units="s"))
+    float TargetCacheTTL = 0.0f;
+
+    /** Interpreters kept per profile for reuse by respawned agents (0 = no pooling). */
+    UPROPERTY(Config, EditAnywhere, Category="Pooling", meta=(ClampMin="0"))
+    int32 MaxPooledInterpretersPerProfile = 32;
 };
@@ -8,17 +8,131 @@
 
 #include "CoreMinimal.h"
 #include "Subsystems/GameInstanceSubsystem.h"
+#include "Tickable.h"
+#include "AI/Navigation/NavigationTypes.h"
+#include "WorldCollision.h"
+#include "Tasks/Task.h"
+#include "EAIS_Program.h"
+#include "AIInterpreter.h"
 #include "EAISSubsystem.generated.h"
 
 class UAIAction;
 class UAIBehaviour;
+class UAIComponent;
+class AActor;
+class ANavigationData;
+struct FAIActionParams;
+enum class EAIActionStatus : uint8;
+
+/**
+ * Per-frame scratch entry used by the agent scheduler
+ */
+struct FEAISScheduledAgent
+{
+    UAIComponent* Agent = nullptr;
+    FAIInterpreter* Interpreter = nullptr;
+    float DeltaSeconds = 0.0f;
+    int32 NumSteps = 0;
+    int32 TransitionRank = INDEX_NONE;
+
+    /** Program and state TransitionRank was selected in */
+    const FEAISCompiledProgram* SelectedProgram = nullptr;
+    int32 SelectedState = INDEX_NONE;
+
+    int32 ScheduleIndex = INDEX_NONE;
+    bool bActive = false;
+};
+
+/**
+ * A MoveTo goal waiting for an async path query
+ */
+struct FEAISPendingMove
+{
+    TWeakObjectPtr<UAIComponent> Agent;
+    FVector Goal = FVector::ZeroVector;
+    float AcceptanceRadius = 0.0f;
+};
+
+/**
+ * What moves must have in common to share a path query: the same navigation data (chosen from the
+ * agent's nav properties), query filter, and start/goal cells
+ */
+struct FEAISPathShareKey
+{
+    const ANavigationData* NavData = nullptr;
+    const UClass* FilterClass = nullptr;
+    FIntVector StartCell = FIntVector::ZeroValue;
+    FIntVector GoalCell = FIntVector::ZeroValue;
+
+    bool operator==(const FEAISPathShareKey& Other) const
+    {
+        return NavData == Other.NavData && FilterClass == Other.FilterClass && StartCell == Other.StartCell && GoalCell == Other.GoalCell;
+    }
+
+    friend uint32 GetTypeHash(const FEAISPathShareKey& Key)
+    {
+        return HashCombine(HashCombine(GetTypeHash(Key.NavData), GetTypeHash(Key.FilterClass)), HashCombine(GetTypeHash(Key.StartCell), GetTypeHash(Key.GoalCell)));
+    }
+};
+
+/**
+ * An async path query shared by agents with near-identical start and goal
+ */
+struct FEAISPathQuery
+{
+    uint32 QueryId = 0;
+    FEAISPathShareKey ShareKey;
+    uint64 DispatchFrame = 0;
+    TArray<FEAISPendingMove, TInlineAllocator<4>> Moves;
+    FNavPathSharedPtr Path;
+    bool bFinished = false;
+    bool bSucceeded = false;
+};
+
+/**
+ * A scoring query candidate (registered actor or grid point) and its accumulated score
+ */
+struct FEAISScoringCandidate
+{
+    TWeakObjectPtr<AActor> Actor;
+    FVector Location = FVector::ZeroVector;
+    FTraceHandle Trace;
+    float Score = 0.0f;
+    bool bRejected = false;
+};
+
+/**
+ * One agent's scoring query. Candidates are gathered on the game thread, scored on a worker task
+ * (batched with every other query of the frame) and line-of-sight tested with async traces.
+ */
+struct FEAISScoringJob
+{
+    TWeakObjectPtr<UAIComponent> Agent;
+    TSharedPtr<const FEAISCompiledProgram> Program;
+    int32 QueryIndex = INDEX_NONE;
+    uint32 Serial = 0;
+    uint64 DispatchFrame = 0;
+    FVector Origin = FVector::ZeroVector;
+    FVector Forward = FVector::ForwardVector;
+    TArray<FEAISScoringCandidate> Candidates;
+};
+
+/**
+ * An actor visible to team queries, with its team and role cached at registration
+ */
+struct FEAISQueryActor
+{
+    TWeakObjectPtr<AActor> Actor;
+    int32 TeamId = 0;
+    FName Role;
+};
 
 /**
  * Game Instance Subsystem for EAIS.
- * Manages global AI resources, action registry, and blackboard factories.
+ * Manages global AI resources, action registry, blackboard factories and the agent tick scheduler.
  */
 UCLASS()
-class P_EAIS_API UEAISSubsystem : public UGameInstanceSubsystem
+class P_EAIS_API UEAISSubsystem : public UGameInstanceSubsystem, public FTickableGameObject
 {
     GENERATED_BODY()
 
@@ -28,6 +142,14 @@ public:
     virtual void Initialize(FSubsystemCollectionBase& Collection) override;
     virtual void Deinitialize() override;
 
+    // ==================== FTickableGameObject ====================
+
+    virtual void Tick(float DeltaTime) override;
+    virtual TStatId GetStatId() const override;
+    virtual ETickableTickType GetTickableTickType() const override;
+    virtual bool IsTickable() const override;
+    virtual UWorld* GetTickableGameObjectWorld() const override;
+
     // ==================== Static Access ====================
 
     /** Get the subsystem from a world context */
@@ -66,6 +188,140 @@ public:
     UFUNCTION(BlueprintCallable, Category = "EAIS|Behaviors")
     TArray<FString> GetAvailableBehaviors() const;
 
+    // ==================== Agent Scheduler ====================
+
+    /** Register an AI component with the scheduler. Returns true if the subsystem now drives its tick. */
+    bool RegisterAgent(UAIComponent* Agent);
+
+    /** Remove an AI component from the scheduler */
+    void UnregisterAgent(UAIComponent* Agent);
+
+    /** Number of agents driven by the scheduler */
+    UFUNCTION(BlueprintPure, Category = "EAIS|Scheduler")
+    int32 GetNumScheduledAgents() const { return ScheduledAgents.Num(); }
+
+    /** Number of due agents pushed to the next frame by the frame budget last frame */
+    UFUNCTION(BlueprintPure, Category = "EAIS|Scheduler")
+    int32 GetNumDeferredAgents() const { return NumDeferredAgents; }
+
+    /** Number of times an agent hit StarvationWarningFrames consecutive deferrals */
+    UFUNCTION(BlueprintPure, Category = "EAIS|Scheduler")
+    int32 GetNumStarvationReports() const { return NumStarvationReports; }
+
+    // ==================== Interpreter Pool ====================
+
+    /** Move a pooled interpreter already loaded with Program into Interpreter. False if none is pooled. */
+    bool AcquireInterpreter(const TSharedPtr<const FEAISCompiledProgram>& Program, FAIInterpreter& Interpreter);
+
+    /** Keep an agent's interpreter storage for the next agent on the same program; Interpreter is left without a program */
+    void ReleaseInterpreter(FAIInterpreter& Interpreter);
+
+    /** Interpreters waiting for reuse across all profiles */
+    UFUNCTION(BlueprintPure, Category = "EAIS|Scheduler")
+    int32 GetNumPooledInterpreters() const;
+
+    // ==================== Input Routing ====================
+
+    /**
+     * Route a P_MEIS input action received by Target (a pawn or controller) to its AI as the event mapped in
+     * [EAIS.InputMapping]. Call from the P_MEIS binding or an input replay. False if no AI or no mapping.
+     */
+    UFUNCTION(BlueprintCallable, Category = "EAIS|Input")
+    bool RouteInputAction(AActor* Target, FName InputAction, bool bUrgent = false);
+
+    /** Input actions routed to an AI */
+    UFUNCTION(BlueprintPure, Category = "EAIS|Input")
+    int32 GetNumRoutedInputs() const { return NumRoutedInputs; }
+
+    // ==================== Movement ====================
+
+    /**
+     * Move an agent toward Goal. Requests close to the agent's active goal (RetargetDistance), or issued again
+     * within RetargetInterval while moving, are coalesced and return the active request's status.
+     * With bAsyncPathfinding the path is queried asynchronously and applied next frame (status Running meanwhile).
+     */
+    EAIActionStatus RequestMove(UAIComponent* Agent, const FVector& Goal, const FAIActionParams& Params);
+
+    /** Move requests accepted (not coalesced) */
+    UFUNCTION(BlueprintPure, Category = "EAIS|Movement")
+    int32 GetNumMoveRequests() const { return NumMoveRequests; }
+
+    /** Async path queries dispatched (after sharing between agents) */
+    UFUNCTION(BlueprintPure, Category = "EAIS|Movement")
+    int32 GetNumPathQueries() const { return NumPathQueries; }
+
+    /** Move requests absorbed by an already active request */
+    UFUNCTION(BlueprintPure, Category = "EAIS|Movement")
+    int32 GetNumCoalescedMoveRequests() const { return NumCoalescedMoveRequests; }
+
+    // ==================== Team Queries ====================
+
+    /** Make an actor visible to team queries. Team/role are read once from IEAIS_TargetProvider (AI agents register themselves). */
+    UFUNCTION(BlueprintCallable, Category = "EAIS|Queries")
+    void RegisterQueryActor(AActor* Actor);
+
+    /** Remove an actor from team queries */
+    UFUNCTION(BlueprintCallable, Category = "EAIS|Queries")
+    void UnregisterQueryActor(AActor* Actor);
+
+    /** Re-read the cached team/role of a registered actor (call after it changes team or role) */
+    UFUNCTION(BlueprintCallable, Category = "EAIS|Queries")
+    void RefreshQueryActor(AActor* Actor);
+
+    /** Cached team id of a registered actor (0 = no team or not registered) */
+    UFUNCTION(BlueprintPure, Category = "EAIS|Queries")
+    int32 GetCachedTeamId(const AActor* Actor) const;
+
+    /** Nearest registered actor to Origin passing the filter (MaxDistance 0 = unlimited) */
+    UFUNCTION(BlueprintCallable, Category = "EAIS|Queries")
+    AActor* FindNearest(const AActor* Querier, const FVector& Origin, const FEAISQueryFilter& Filter, float MaxDistance = 0.0f) const;
+
+    /** Registered actors within Radius of Origin passing the filter */
+    UFUNCTION(BlueprintCallable, Category = "EAIS|Queries")
+    void FindInRadius(const AActor* Querier, const FVector& Origin, float Radius, const FEAISQueryFilter& Filter, TArray<AActor*>& OutActors) const;
+
+    /** Highest-scoring registered actor passing the filter; candidates scoring below zero are rejected */
+    AActor* FindBestScored(const AActor* Querier, const FEAISQueryFilter& Filter, TFunctionRef<float(const AActor& Candidate, const FVector& Location)> Score) const;
+
+    // ==================== Shared Blackboards ====================
+
+    /** Write a "team.<Key>" value for every agent on a team */
+    UFUNCTION(BlueprintCallable, Category = "EAIS|Blackboard")
+    void SetTeamBlackboardValue(int32 TeamId, FName Key, const FBlackboardValue& Value);
+
+    /** Read a "team.<Key>" value */
+    UFUNCTION(BlueprintCallable, Category = "EAIS|Blackboard")
+    bool GetTeamBlackboardValue(int32 TeamId, FName Key, FBlackboardValue& OutValue) const;
+
+    /** Write a "global.<Key>" value for every agent */
+    UFUNCTION(BlueprintCallable, Category = "EAIS|Blackboard")
+    void SetGlobalBlackboardValue(FName Key, const FBlackboardValue& Value);
+
+    /** Read a "global.<Key>" value */
+    UFUNCTION(BlueprintCallable, Category = "EAIS|Blackboard")
+    bool GetGlobalBlackboardValue(FName Key, FBlackboardValue& OutValue) const;
+
+    /** Shared blackboard of a team (created on first use) */
+    TSharedRef<FEAISSharedBlackboard> GetTeamBlackboard(int32 TeamId);
+
+    /** Blackboard shared by every agent */
+    const TSharedRef<FEAISSharedBlackboard>& GetGlobalBlackboard() const { return GlobalBlackboard; }
+
+    /** Point an agent's "team."/"global." keys at the blackboards of its cached team */
+    void BindSharedBlackboards(UAIComponent* Agent);
+
+    // ==================== Scoring Queries ====================
+
+    /**
+     * Queue the behavior's scoring query QueryIndex for an agent. It runs with the other queries of the frame
+     * and its best candidate is written to the query's result key in a later frame (status Running meanwhile).
+     */
+    EAIActionStatus RequestScoringQuery(UAIComponent* Agent, int32 QueryIndex);
+
+    /** Scoring queries dispatched */
+    UFUNCTION(BlueprintPure, Category = "EAIS|Queries")
+    int32 GetNumScoringQueries() const { return NumScoringQueries; }
+
     // ==================== Debug ====================
 
     /** Enable/disable global debug mode */
@@ -89,9 +345,210 @@ protected:
     UPROPERTY()
     TMap<FString, UAIAction*> ActionInstances;
 
+    /** Behaviors loaded from file, keyed by resolved path (agents on the same profile share one program) */
+    UPROPERTY()
+    TMap<FString, UAIBehaviour*> LoadedBehaviors;
+
     /** Global debug mode */
     bool bGlobalDebugMode = false;
 
     /** Register default actions */
     void RegisterDefaultActions();
+
+    // ==================== Scheduler State ====================
+
+    /** Agents ticked by the scheduler, in registration order */
+    TArray<TWeakObjectPtr<UAIComponent>> ScheduledAgents;
+
+    /** Is the scheduler enabled (from UEAISSettings) */
+    bool bUseAgentScheduler = true;
+
+    /** Batch transition evaluation (from UEAISSettings) */
+    bool bBatchTransitionEvaluation = true;
+
+    /** Per-frame AI budget in milliseconds (0 = unlimited, from UEAISSettings) */
+    float FrameBudgetMs = 0.0f;
+
+    /** Consecutive deferrals before an agent is reported as starved (from UEAISSettings) */
+    int32 StarvationWarningFrames = 30;
+
+    /** Step interpreters at a fixed rate (from UEAISSettings) */
+    bool bUseFixedTimestep = false;
+
+    /** Fixed step length in seconds */
+    float FixedStepSeconds = 0.05f;
+
+    /** Maximum fixed steps per agent per frame */
+    int32 MaxSubstepsPerFrame = 4;
+
+    /** Agents processed between budget checks */
+    static constexpr int32 BudgetSliceSize = 32;
+
+    /** Schedule index the next frame starts from (first agent deferred by the budget) */
+    int32 RoundRobinCursor = 0;
+
+    /** Due agents left unprocessed last frame */
+    int32 NumDeferredAgents = 0;
+
+    /** Total starvation reports */
+    int32 NumStarvationReports = 0;
+
+    /** Agents due this frame in round-robin order (scratch, reused) */
+    TArray<FEAISScheduledAgent> DueAgents;
+
+    /** Due agents sorted by (program, state) for batching (scratch, reused) */
+    TArray<int32> BatchOrder;
+
+    /** Condition columns for SelectTransitionsBatch (scratch, reused) */
+    FEAISTransitionBatchScratch BatchScratch;
+
+    /** Run one scheduler frame */
+    void TickAgents(float DeltaTime);
+
+    /** Tick DueAgents[Begin, End), running fixed substeps in rounds */
+    void ProcessDueAgents(int32 Begin, int32 End);
+
+    /** Run one tick for every agent in DueAgents[Begin, End) with more than Round steps */
+    void RunTickRound(int32 Begin, int32 End, int32 Round);
+
+    /** Select transitions for DueAgents[Begin, End) grouped by (program, state) */
+    void SelectTransitionsBatched(int32 Begin, int32 End);
+
+    // ==================== Tick LOD ====================
+
+    /** Time until agent LOD levels are recomputed */
+    float LODUpdateTimer = 0.0f;
+
+    /** Were LOD intervals applied (so they can be cleared when LOD is switched off) */
+    bool bLODApplied = false;
+
+    /** Human player pawns and tagged focus actors gathered this LOD update (scratch, reused) */
+    TArray<FVector> LODFocusPoints;
+
+    /** Cached actors carrying the LOD focus tag */
+    TArray<TWeakObjectPtr<AActor>> LODFocusActors;
+
+    /** World time of the next tagged-actor search (avoids iterating all actors while none exist) */
+    double NextFocusActorSearchTime = 0.0;
+
+    /** Recompute per-agent tick intervals from distance to focus points */
+    void UpdateAgentLOD(float DeltaTime);
+
+    /** Collect human player pawn and tagged actor locations */
+    void GatherLODFocusPoints(UWorld& World, FName FocusTag);
+
+    /** Is the actor net relevant to any local or remote human player */
+    static bool IsRelevantToAnyPlayer(UWorld& World, const AActor& Actor);
+
+    // ==================== Input Routing State ====================
+
+    /** Total input actions routed */
+    int32 NumRoutedInputs = 0;
+
+    /** AI component of a pawn or controller (or of the controller's pawn / pawn's controller) */
+    static UAIComponent* FindInputTarget(AActor* Target);
+
+    // ==================== Movement State ====================
+
+    /** Total move requests issued */
+    int32 NumMoveRequests = 0;
+
+    /** Total move requests coalesced */
+    int32 NumCoalescedMoveRequests = 0;
+
+    /** Total async path queries dispatched */
+    int32 NumPathQueries = 0;
+
+    /** Resolve moves with async path queries (from UEAISSettings) */
+    bool bAsyncPathfinding = true;
+
+    /** Path queries dispatched per frame (from UEAISSettings) */
+    int32 MaxPathQueriesPerFrame = 8;
+
+    /** Cell size for sharing path queries (from UEAISSettings) */
+    float PathQueryShareDistance = 100.0f;
+
+    /** Moves collected this frame (and any left over by MaxPathQueriesPerFrame) */
+    TArray<FEAISPendingMove> PendingMoves;
+
+    /** Path queries in flight or finished and waiting for delivery */
+    TArray<FEAISPathQuery> PathQueries;
+
+    /** Dispatch pending moves as async path queries, sharing queries between agents */
+    void DispatchPathQueries();
+
+    /** Apply finished path queries to their agents */
+    void DeliverPathResults();
+
+    /** Start path following for one agent of a finished query */
+    void DeliverPath(const FEAISPathQuery& Query, const FEAISPendingMove& Move, bool bOwnsPath);
+
+    /** Async path query callback */
+    void OnPathQueryFinished(uint32 QueryId, ENavigationQueryResult::Type Result, FNavPathSharedPtr Path);
+
+    /** Cell used to decide whether two moves can share a path query */
+    FIntVector GetPathShareCell(const FVector& Location) const;
+
+    // ==================== Query State ====================
+
+    /** Actors visible to team queries */
+    TArray<FEAISQueryActor> QueryActors;
+
+    /** Read team/role from the actor's IEAIS_TargetProvider */
+    static void CacheTeamInfo(FEAISQueryActor& Entry);
+
+    /** Registry index of an actor, INDEX_NONE if not registered */
+    int32 FindQueryActor(const AActor* Actor) const;
+
+    /** Call Visit(Actor, Location) for every live registered actor passing the filter */
+    template <typename FunctorType>
+    void ForEachQueryActor(const AActor* Querier, const FEAISQueryFilter& Filter, FunctorType&& Visit) const;
+
+    // ==================== Interpreter Pool State ====================
+
+    /** Released interpreters per program (each keeps its program alive, so the key stays valid) */
+    TMap<const FEAISCompiledProgram*, TArray<FAIInterpreter>> InterpreterPool;
+
+    /** Cap per program (from settings) */
+    int32 MaxPooledInterpretersPerProfile = 32;
+
+    // ==================== Shared Blackboard State ====================
+
+    /** "global." keys */
+    TSharedRef<FEAISSharedBlackboard> GlobalBlackboard = MakeShared<FEAISSharedBlackboard>();
+
+    /** "team." keys per team id */
+    TMap<int32, TSharedRef<FEAISSharedBlackboard>> TeamBlackboards;
+
+    // ==================== Scoring Query State ====================
+
+    /** Total scoring queries dispatched */
+    int32 NumScoringQueries = 0;
+
+    /** Scoring queries dispatched per frame (from UEAISSettings) */
+    int32 MaxScoringQueriesPerFrame = 16;
+
+    /** Serial handed to the next request (0 = none) */
+    uint32 NextScoringSerial = 0;
+
+    /** Requests collected this frame (and any left over by MaxScoringQueriesPerFrame) */
+    TArray<FEAISScoringJob> PendingScoringJobs;
+
+    /** Dispatched jobs waiting for their scoring task and traces */
+    TArray<FEAISScoringJob> ScoringJobs;
+
+    /** Worker task scoring the jobs dispatched last */
+    UE::Tasks::FTask ScoringTask;
+
+    /** Gather candidates, start traces and launch the scoring task for pending jobs */
+    void DispatchScoringQueries();
+
+    /** Write the best candidate of every finished job to its agent's blackboard */
+    void DeliverScoringResults();
+
+    /** Fill a job's candidates from its query's generator */
+    void GenerateCandidates(FEAISScoringJob& Job, const AActor& Querier) const;
+
+    /** Apply the non-trace tests to a batch of jobs (runs on a worker thread) */
+    static void ScoreJobs(TArrayView<FEAISScoringJob> Jobs);
 };
@@ -0,0 +1,27 @@
+// Copyright Punal Manalan. All Rights Reserved.
+// Native kick interface (direct virtual call instead of the ExecuteShoot reflection lookup)
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "UObject/Interface.h"
+#include "EAIS_KickHandler.generated.h"
+
+UINTERFACE(MinimalAPI, meta = (CannotImplementInterfaceInBlueprint))
+class UEAIS_KickHandler : public UInterface
+{
+    GENERATED_BODY()
+};
+
+/**
+ * Implement on a C++ Pawn to receive UAIAction_Kick directly.
+ * Pawns without it are called through a reflected ExecuteShoot(FVector Direction, float Power) function.
+ */
+class P_EAIS_API IEAIS_KickHandler
+{
+    GENERATED_BODY()
+
+public:
+    /** Kick the ball in Direction with Power (0-1) */
+    virtual void EAIS_Kick(const FVector& Direction, float Power) = 0;
+};
@@ -0,0 +1,248 @@
+/*
+ * @Author: Punal Manalan
+ * @Description: FEAISCompiledProgram - Immutable, shareable runtime form of a behavior definition
+ * @Date: 18/10/2026
+ */
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "EAIS_Types.h"
+
+/**
+ * A condition flattened for runtime evaluation.
+ * Compare values are parsed once for every blackboard type so Tick never parses strings.
+ */
+struct P_EAIS_API FEAISCompiledCondition
+{
+    /** Condition type (mirrors FAICondition::Type) */
+    EAIConditionType Type = EAIConditionType::Blackboard;
+
+    /** Comparison operator */
+    EAIConditionOperator Operator = EAIConditionOperator::Equal;
+
+    /** Blackboard slot of the key (Blackboard) or target (Distance) */
+    int32 Slot = INDEX_NONE;
+
+    /** Compare value with Bool/Int/Float/String/Vector fields all pre-parsed */
+    FBlackboardValue CompareValue;
+
+    /** Pre-parsed distance for Distance conditions */
+    float CompareDistance = 0.0f;
+
+    /** Duration for Timer conditions */
+    float Seconds = 0.0f;
+
+    /** Interned event id for Event conditions */
+    int32 EventId = INDEX_NONE;
+
+    /** Accepted EAIActionStatus bits for Action conditions */
+    uint8 StatusMask = 0;
+
+    /** Event name / key name as authored */
+    FString Name;
+
+    /** Child condition indices for And/Or/Not */
+    TArray<int32> Children;
+};
+
+/**
+ * A transition with its target state resolved to an index.
+ */
+struct P_EAIS_API FEAISCompiledTransition
+{
+    /** Target state index (INDEX_NONE if the target does not exist) */
+    int32 TargetState = INDEX_NONE;
+
+    /** Root condition index into FEAISCompiledProgram::Conditions */
+    int32 Condition = INDEX_NONE;
+
+    /** Index of the transition in the authored FAIState::Transitions array */
+    int32 SourceIndex = INDEX_NONE;
+};
+
+/**
+ * Per-state runtime data.
+ */
+struct P_EAIS_API FEAISCompiledState
+{
+    /** Transitions sorted by priority (ties keep authored order) */
+    TArray<FEAISCompiledTransition> Transitions;
+
+    /** Ranks of transitions that can pass without an event, ascending */
+    TArray<int32> NonEventRanks;
+
+    /** Event id -> ranks of transitions that require that event, ascending */
+    TMap<int32, TArray<int32>> EventRanks;
+};
+
+/**
+ * Default of a "team."/"global." key, written to the shared blackboard if it lacks the key.
+ */
+struct P_EAIS_API FEAISSharedDefault
+{
+    EEAISBlackboardScope Scope = EEAISBlackboardScope::Team;
+
+    /** Key in the shared blackboard (without the scope prefix) */
+    FName Key;
+
+    FBlackboardValue Value;
+};
+
+/**
+ * One [EAIS.InputMapping] entry: a P_MEIS input action routed to the AI as an event.
+ */
+struct P_EAIS_API FEAISInputMapping
+{
+    FName InputAction;
+    FString EventName;
+};
+
+/**
+ * Compiled behavior shared by every interpreter running the same profile.
+ * Built once from an FAIBehaviorDef; never mutated afterwards.
+ */
+struct P_EAIS_API FEAISCompiledProgram
+{
+    /** Source definition (states, actions, blackboard defaults) */
+    FAIBehaviorDef Def;
+
+    /** Compiled states, parallel to Def.States */
+    TArray<FEAISCompiledState> States;
+
+    /** Flattened condition pool */
+    TArray<FEAISCompiledCondition> Conditions;
+
+    /** Interned id of each state, parallel to Def.States */
+    TArray<FName> StateNames;
+
+    /** Blackboard key for each slot */
+    TArray<FString> SlotKeys;
+
+    /** Event name for each interned event id */
+    TArray<FString> EventNames;
+
+    /** Parsed default of every slot, parallel to SlotKeys; copied on Reset instead of re-parsing (shared slots use it while unbound) */
+    TArray<FBlackboardValue> DefaultImage;
+
+    /** Which slots of DefaultImage hold a default */
+    TBitArray<> DefaultImageSet;
+
+    /** Parsed defaults of team/global keys */
+    TArray<FEAISSharedDefault> SharedDefaults;
+
+    /** Input action -> event id from [EAIS.InputMapping] (mapped events are always interned) */
+    TMap<FName, int32> InputEventIds;
+
+    /** Initial state index */
+    int32 InitialState = INDEX_NONE;
+
+    /** Unique per compiled program (identifies the slot layout a key handle was resolved against) */
+    uint32 Serial = 0;
+
+    /** Compile a behavior definition (project-wide [EAIS.Blackboard] defaults are merged in for keys it does not declare) */
+    static TSharedRef<const FEAISCompiledProgram> Compile(const FAIBehaviorDef& InDef);
+
+    /** Find a state index by ID */
+    int32 FindState(const FString& StateId) const;
+
+    /** Find a blackboard slot by key */
+    int32 FindSlot(const FString& Key) const;
+
+    /** Find an event id by name (INDEX_NONE if neither a condition nor an input mapping references it) */
+    int32 FindEvent(const FString& EventName) const;
+
+    /** Event id an input action is mapped to, INDEX_NONE if unmapped */
+    int32 FindInputEvent(FName InputAction) const;
+
+    /** Find a scoring query index (into Def.Queries) by name */
+    int32 FindQuery(const FString& QueryName) const;
+
+    /** Number of blackboard slots known at compile time */
+    int32 NumSlots() const { return SlotKeys.Num(); }
+
+    /** Scope of a program slot ("team."/"global." keys live in shared blackboards) */
+    EEAISBlackboardScope GetSlotScope(int32 Slot) const { return SlotScopes[Slot]; }
+
+    /** Key of a shared slot in its shared blackboard (the name without the scope prefix) */
+    FName GetSlotSharedKey(int32 Slot) const { return SlotSharedKeys[Slot]; }
+
+    /** Does any slot live in a shared blackboard */
+    bool HasSharedSlots() const { return bHasSharedSlots; }
+
+private:
+    /** State ID -> index */
+    TMap<FString, int32> StateIndexById;
+
+    /** Blackboard key -> slot */
+    TMap<FString, int32> SlotByKey;
+
+    /** Event name -> event id */
+    TMap<FString, int32> EventIdByName;
+
+    /** Query name -> index into Def.Queries */
+    TMap<FString, int32> QueryIndexByName;
+
+    /** Scope of each slot, parallel to SlotKeys */
+    TArray<EEAISBlackboardScope> SlotScopes;
+
+    /** Shared key of each slot (None for agent slots), parallel to SlotKeys */
+    TArray<FName> SlotSharedKeys;
+
+    /** Any slot with a team or global scope */
+    bool bHasSharedSlots = false;
+
+    int32 AddSlot(const FString& Key);
+    void BuildDefaultImage();
+    void PrepareActions(TArray<FAIActionEntry>& Actions);
+    int32 AddEvent(const FString& EventName);
+    int32 CompileCondition(const FAICondition& Condition);
+
+    /** Event id a condition cannot pass without (Event, or And with a direct Event child), else INDEX_NONE */
+    int32 GetRequiredEvent(int32 ConditionIndex) const;
+};
+
+namespace EAIS
+{
+    /** Numeric comparison shared by scalar and batched condition evaluation */
+    FORCEINLINE bool CompareScalar(float A, float B, EAIConditionOperator Op, float Tolerance)
+    {
+        switch (Op)
+        {
+        case EAIConditionOperator::Equal:          return FMath::Abs(A - B) <= Tolerance;
+        case EAIConditionOperator::NotEqual:       return FMath::Abs(A - B) > Tolerance;
+        case EAIConditionOperator::GreaterThan:    return A > B;
+        case EAIConditionOperator::LessThan:       return A < B;
+        case EAIConditionOperator::GreaterOrEqual: return A >= B;
+        case EAIConditionOperator::LessOrEqual:    return A <= B;
+        default:                                   return false;
+        }
+    }
+
+    /** Tolerance used by Distance conditions for Equal/NotEqual */
+    constexpr float DistanceEqualTolerance = 10.0f;
+
+    /** Bit for an action status in FEAISCompiledCondition::StatusMask */
+    constexpr uint8 ActionStatusBit(EAIActionStatus Status) { return static_cast<uint8>(1 << static_cast<uint8>(Status)); }
+
+    /** Parse an Action condition value (Succeeded/Failed/Running/Completed; empty = Succeeded) to a status mask */
+    P_EAIS_API uint8 ParseActionStatusMask(const FString& Value);
+
+    /** Parse a blackboard default ("true"/"1", numbers, "(X=..,Y=..,Z=..)"); Object keys stay Object with a null value, anything else is kept as a string */
+    P_EAIS_API FBlackboardValue MakeDefaultValue(EBlackboardValueType Type, const FString& RawValue);
+
+    /** Project-wide blackboard defaults from [EAIS.Blackboard] in the plugin's DefaultEAIS.ini (the project's DefaultGame.ini may add or override keys) */
+    P_EAIS_API const TArray<FEAISBlackboardEntry>& GetConfigBlackboardDefaults();
+
+    /** Project-wide input action -> event mappings from [EAIS.InputMapping] in the plugin's DefaultEAIS.ini (DefaultGame.ini may add or override actions) */
+    P_EAIS_API const TArray<FEAISInputMapping>& GetConfigInputMappings();
+
+    /** Scope of a blackboard key: "team.X" and "global.X" are shared (OutSharedKey = X), anything else belongs to the agent */
+    P_EAIS_API EEAISBlackboardScope ParseBlackboardScope(const FString& Key, FName& OutSharedKey);
+
+    /** Prefix that binds an action target to a blackboard key ("$TargetLocation") */
+    constexpr TCHAR BlackboardBindingPrefix = TEXT('$');
+
+    /** Params the Execute action forwards to IEAIS_ActionExecutor (target/power taken from ExtraParams) */
+    P_EAIS_API FAIActionParams MakeExecuteInnerParams(const FAIActionParams& Params);
+}
@@ -31,6 +31,25 @@ public:
     UFUNCTION(BlueprintNativeEvent, BlueprintCallable, Category = "EAIS")
     bool EAIS_GetTargetLocation(FName TargetId, FVector& OutLocation) const;
     virtual bool EAIS_GetTargetLocation_Implementation(FName TargetId, FVector& OutLocation) const { return false; }
+
+    /**
+     * Resolve several target IDs in one call (the AI component batches every target an agent uses each frame).
+     * Override to avoid one Blueprint dispatch per target; the default calls EAIS_GetTargetLocation for each.
+     * @param TargetIds Logical IDs of the targets
+     * @param OutLocations Resulting world locations, parallel to TargetIds
+     * @param OutResolved Whether each target was resolved, parallel to TargetIds
+     */
+    UFUNCTION(BlueprintNativeEvent, BlueprintCallable, Category = "EAIS")
+    void EAIS_GetTargetLocations(const TArray<FName>& TargetIds, TArray<FVector>& OutLocations, TArray<bool>& OutResolved) const;
+    virtual void EAIS_GetTargetLocations_Implementation(const TArray<FName>& TargetIds, TArray<FVector>& OutLocations, TArray<bool>& OutResolved) const
+    {
+        OutLocations.SetNumZeroed(TargetIds.Num());
+        OutResolved.SetNumZeroed(TargetIds.Num());
+        for (int32 Index = 0; Index < TargetIds.Num(); ++Index)
+        {
+            OutResolved[Index] = Execute_EAIS_GetTargetLocation(_getUObject(), TargetIds[Index], OutLocations[Index]);
+        }
+    }
     
     /**
      * Resolve a target ID to an actor.
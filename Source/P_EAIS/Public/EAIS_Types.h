@@ -48,8 +48,15 @@ struct P_EAIS_API FAIEventPayload
     /** Timestamp of the event */
     UPROPERTY(BlueprintReadOnly, Category = "EAIS")
     float Timestamp = 0.0f;
+
+    /** Wake the agent in the current or next frame, ignoring its tick interval and LOD */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "EAIS")
+    bool bUrgent = false;
 };
 
+struct FEAISActionParamBlock;
+struct FEAISParamValue;
+
 /**
  * Parameters for AI actions
  */
@@ -66,9 +73,42 @@ struct P_EAIS_API FAIActionParams
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "EAIS")
     float Power = 1.0f;
 
+    /** Move goal acceptance radius (MoveTo) */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "EAIS|Move", meta = (ClampMin = "0.0"))
+    float AcceptanceRadius = 50.0f;
+
+    /** A move goal closer than this to the active one is coalesced instead of re-requested (MoveTo) */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "EAIS|Move", meta = (ClampMin = "0.0"))
+    float RetargetDistance = 25.0f;
+
+    /** Minimum seconds between move requests while a move is active (MoveTo) */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "EAIS|Move", meta = (ClampMin = "0.0"))
+    float RetargetInterval = 0.15f;
+
     /** Additional string parameters */
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "EAIS")
     TMap<FString, FString> ExtraParams;
+
+    /** Target interned when the program is compiled (None for params built at runtime) */
+    FName TargetName;
+
+    /** Params forwarded by the Execute action, built when the program is compiled */
+    TSharedPtr<const FAIActionParams> InnerParams;
+
+    /** Blackboard slot of a "$Key" target, resolved when the program is compiled */
+    int32 TargetSlot = INDEX_NONE;
+
+    /** Target as an FName (interned at compile time when available) */
+    FName GetTargetName() const { return TargetName.IsNone() ? FName(*Target) : TargetName; }
+
+    /** Is the target bound to a blackboard key ("$Key")? */
+    bool IsTargetBound() const { return TargetSlot != INDEX_NONE; }
+
+    /** Typed params parsed from ExtraParams by the action's schema when the program is compiled (see UAIAction::DeclareParams); shared by copies */
+    TSharedPtr<const FEAISActionParamBlock> ParamBlock;
+
+    /** Pre-parsed param by schema index, null if it was not given or the block was not built for ActionClass's schema */
+    const FEAISParamValue* GetParam(const UClass* ActionClass, int32 Index) const;
 };
 
 /**
@@ -92,7 +132,23 @@ enum class EAIConditionType : uint8
     /** Composite condition (Any sub-condition must be true) */
     Or,
     /** Composite condition (The sub-condition must be false) */
-    Not
+    Not,
+    /** Status of an action started in the current state (name = action, value = Succeeded/Failed/Running/Completed) */
+    Action
+};
+
+/**
+ * Result of executing or ticking an AI action
+ */
+UENUM(BlueprintType)
+enum class EAIActionStatus : uint8
+{
+    /** Action finished successfully */
+    Succeeded,
+    /** Action could not complete */
+    Failed,
+    /** Action is latent and still in progress */
+    Running
 };
 
 /**
@@ -183,6 +239,101 @@ struct P_EAIS_API FBlackboardValue
 
     /** Compare with another value */
     bool Compare(const FBlackboardValue& Other, EAIConditionOperator Op) const;
+
+    /** Same type and exactly the same typed value (used to coalesce change notifications) */
+    bool Identical(const FBlackboardValue& Other) const;
+};
+
+/**
+ * How an action parameter is parsed when its action entry is prepared
+ */
+UENUM()
+enum class EEAISParamType : uint8
+{
+    Bool,
+    Int,
+    Float,
+    /** "(X=..,Y=..,Z=..)" literal; unset if the text is not a vector */
+    Vector,
+    Name,
+    String,
+    /** Bool if "true"/"false", Float if numeric, String otherwise */
+    Auto
+};
+
+/**
+ * One pre-parsed action parameter
+ */
+struct P_EAIS_API FEAISParamValue
+{
+    /** Parsed value (Type follows the schema; Auto picks it from the text) */
+    FBlackboardValue Value;
+
+    /** Interned value for Name params */
+    FName Name;
+
+    /** Was the parameter given (and parsed) */
+    bool bIsSet = false;
+};
+
+/**
+ * Parameters of one action entry in schema order, built once and shared by every agent
+ */
+struct P_EAIS_API FEAISActionParamBlock
+{
+    /** Action class whose schema laid out Values (indices mean nothing to any other class) */
+    TWeakObjectPtr<const UClass> SchemaOwner;
+
+    TArray<FEAISParamValue> Values;
+};
+
+/**
+ * Owner of a blackboard key: the agent, or a blackboard shared through UEAISSubsystem ("team.X" / "global.X")
+ */
+enum class EEAISBlackboardScope : uint8
+{
+    Agent,
+    Team,
+    Global
+};
+
+/**
+ * Blackboard shared by a team or by all agents. Owned by UEAISSubsystem and read in place by interpreters.
+ */
+struct P_EAIS_API FEAISSharedBlackboard
+{
+    TMap<FName, FBlackboardValue> Values;
+
+    const FBlackboardValue* Find(FName Key) const { return Values.Find(Key); }
+    FBlackboardValue& FindOrAdd(FName Key) { return Values.FindOrAdd(Key); }
+    void Set(FName Key, const FBlackboardValue& Value) { Values.Add(Key, Value); }
+};
+
+/**
+ * Blackboard key resolved once to a slot of a compiled program, so gets/sets skip the string lookup.
+ * A handle resolved on one agent is valid for every agent running the same behavior.
+ */
+USTRUCT(BlueprintType)
+struct P_EAIS_API FEAISBlackboardKeyHandle
+{
+    GENERATED_BODY()
+
+    /** Blackboard key ("team."/"global." keys are allowed) */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "EAIS")
+    FString Key;
+
+    /** Expected value type, checked against the behavior's default for the key when resolved */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "EAIS")
+    EBlackboardValueType Type = EBlackboardValueType::Float;
+
+    /** Resolved slot (INDEX_NONE until resolved) */
+    int32 Slot = INDEX_NONE;
+
+    /** FEAISCompiledProgram::Serial the slot belongs to */
+    uint32 ProgramSerial = 0;
+
+    FEAISBlackboardKeyHandle() = default;
+    FEAISBlackboardKeyHandle(const FString& InKey, EBlackboardValueType InType) : Key(InKey), Type(InType) {}
 };
 
 /**
@@ -313,6 +464,100 @@ struct P_EAIS_API FAIState
     TArray<FAITransition> Transitions;
 };
 
+/**
+ * Candidate generator of a scoring query
+ */
+UENUM(BlueprintType)
+enum class EEAISQueryGenerator : uint8
+{
+    /** Registered actors on the querier's team */
+    Allies,
+    /** Registered actors on other teams */
+    Enemies,
+    /** Grid of points around the querier */
+    Grid
+};
+
+/**
+ * Scoring test of a scoring query
+ */
+UENUM(BlueprintType)
+enum class EEAISQueryTestType : uint8
+{
+    /** Distance from the querier, normalized over [Min, Max] */
+    Distance,
+    /** Dot product of the querier's forward vector and the direction to the candidate */
+    Dot,
+    /** Unobstructed line from the querier to the candidate (async trace) */
+    LineOfSight
+};
+
+/**
+ * One test of a scoring query. Each test adds Weight * normalized score (0..1) to the candidate.
+ */
+USTRUCT(BlueprintType)
+struct P_EAIS_API FEAISQueryTest
+{
+    GENERATED_BODY()
+
+    /** Test type */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "EAIS")
+    EEAISQueryTestType Type = EEAISQueryTestType::Distance;
+
+    /** Lower bound (Distance: cm, Dot: -1..1) */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "EAIS")
+    float Min = 0.0f;
+
+    /** Upper bound (Distance: cm, Dot: -1..1) */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "EAIS")
+    float Max = 1.0f;
+
+    /** Score weight (negative prefers low values) */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "EAIS")
+    float Weight = 1.0f;
+
+    /** Reject candidates outside [Min, Max] (or without line of sight) instead of scoring them */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "EAIS")
+    bool bFilter = false;
+};
+
+/**
+ * Scoring query declared in the behavior JSON and run by UEAISSubsystem (RunQuery action)
+ */
+USTRUCT(BlueprintType)
+struct P_EAIS_API FEAISQueryDef
+{
+    GENERATED_BODY()
+
+    /** Query name (RunQuery target) */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "EAIS")
+    FString Name;
+
+    /** Candidate generator */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "EAIS")
+    EEAISQueryGenerator Generator = EEAISQueryGenerator::Allies;
+
+    /** Required role for actor generators (None = any) */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "EAIS")
+    FName Role;
+
+    /** Grid generator radius */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "EAIS", meta = (ClampMin = "0.0"))
+    float GridRadius = 1000.0f;
+
+    /** Grid generator spacing */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "EAIS", meta = (ClampMin = "10.0"))
+    float GridSpacing = 200.0f;
+
+    /** Scoring tests */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "EAIS")
+    TArray<FEAISQueryTest> Tests;
+
+    /** Blackboard key receiving the best candidate (actor as Object, grid point as Vector) */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "EAIS")
+    FString ResultKey;
+};
+
 /**
  * AI behavior definition (parsed from JSON)
  */
@@ -337,6 +582,14 @@ struct P_EAIS_API FAIBehaviorDef
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "EAIS")
     TArray<FAIState> States;
 
+    /** Scoring queries run by the RunQuery action */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "EAIS")
+    TArray<FEAISQueryDef> Queries;
+
+    /** Maximum transitions chained within one tick (1 = single transition per tick) */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "EAIS", meta = (ClampMin = "1"))
+    int32 MaxTransitionsPerTick = 1;
+
     /** Is this behavior valid and parsed correctly? */
     UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "EAIS")
     bool bIsValid = false;
@@ -355,6 +608,9 @@ struct FAIQueuedEvent
     FString EventName;
     FAIEventPayload Payload;
     float QueuedTime = 0.0f;
+
+    /** Program event id when enqueued by id (EventName is then left empty) */
+    int32 EventId = INDEX_NONE;
 };
 
 /**
@@ -371,8 +627,72 @@ enum class EAIRunMode : uint8
     Both
 };
 
+/**
+ * Team relation required by a spatial query
+ */
+UENUM(BlueprintType)
+enum class EEAISTeamFilter : uint8
+{
+    /** Any team */
+    Any,
+    /** Same non-zero team as the querier */
+    Allies,
+    /** Different team from the querier */
+    Enemies
+};
+
+/**
+ * Filter for UEAISSubsystem team queries
+ */
+USTRUCT(BlueprintType)
+struct P_EAIS_API FEAISQueryFilter
+{
+    GENERATED_BODY()
+
+    /** Team relation to the querier */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "EAIS")
+    EEAISTeamFilter Team = EEAISTeamFilter::Any;
+
+    /** Required role (None = any role) */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "EAIS")
+    FName Role;
+
+    /** Skip the querier itself */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "EAIS")
+    bool bExcludeSelf = true;
+};
+
 /** Delegate for when AI state changes */
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_TwoParams(FOnAIStateChanged, const FString&, OldState, const FString&, NewState);
 
 /** Delegate for when AI executes an action */
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_TwoParams(FOnAIActionExecuted, const FString&, ActionName, const FAIActionParams&, Params);
+
+/**
+ * State change reported by the native FOnEAISStateChanged delegate (indices into the compiled program)
+ */
+struct FEAISStateChange
+{
+    /** Previous state (INDEX_NONE / None when entering the initial state) */
+    int32 OldState = INDEX_NONE;
+    FName OldStateName;
+
+    /** New state */
+    int32 NewState = INDEX_NONE;
+    FName NewStateName;
+};
+
+/** Native state change delegate (no strings are built) */
+DECLARE_MULTICAST_DELEGATE_OneParam(FOnEAISStateChanged, const FEAISStateChange& /*Change*/);
+
+/** Native action delegate; the entry lives in the compiled program and is not copied */
+DECLARE_MULTICAST_DELEGATE_OneParam(FOnEAISActionExecuted, const FAIActionEntry& /*Entry*/);
+
+/** Native delegate for an event as the interpreter processes it */
+DECLARE_MULTICAST_DELEGATE_TwoParams(FOnEAISEventReceived, const FString& /*EventName*/, const FAIEventPayload& /*Payload*/);
+
+/** Blueprint observer of one blackboard key (an unset key reports a default String value) */
+DECLARE_DYNAMIC_DELEGATE_TwoParams(FOnAIBlackboardKeyChanged, const FString&, Key, const FBlackboardValue&, Value);
+
+/** Native observer of one blackboard key (an unset key reports a default String value) */
+DECLARE_MULTICAST_DELEGATE_TwoParams(FOnEAISBlackboardChanged, const FString& /*Key*/, const FBlackboardValue& /*Value*/);
@@ -1,6 +1,7 @@
 // Copyright Punal Manalan. All Rights Reserved.
 
 #include "FEAISJsonEditorParser.h"
+#include "AIBehaviour.h"
 #include "Dom/JsonObject.h"
 #include "Serialization/JsonReader.h"
 #include "Serialization/JsonSerializer.h"
@@ -37,6 +38,9 @@ static bool ParseActionEntry(const TSharedPtr<FJsonObject>& ActObj, FAIActionEnt
             {
                 ParamsObj->TryGetStringField(TEXT("target"), OutEntry.Params.Target);
                 ParamsObj->TryGetNumberField(TEXT("power"), OutEntry.Params.Power);
+                ParamsObj->TryGetNumberField(TEXT("acceptanceRadius"), OutEntry.Params.AcceptanceRadius);
+                ParamsObj->TryGetNumberField(TEXT("retargetDistance"), OutEntry.Params.RetargetDistance);
+                ParamsObj->TryGetNumberField(TEXT("retargetInterval"), OutEntry.Params.RetargetInterval);
             }
         }
     }
@@ -67,6 +71,7 @@ static bool ParseCondition(const TSharedPtr<FJsonObject>& CondObj, FAICondition&
     else if (TypeStr == TEXT("And")) OutCond.Type = EAIConditionType::And;
     else if (TypeStr == TEXT("Or")) OutCond.Type = EAIConditionType::Or;
     else if (TypeStr == TEXT("Not")) OutCond.Type = EAIConditionType::Not;
+    else if (TypeStr == TEXT("Action")) OutCond.Type = EAIConditionType::Action;
     
     // Support canonical JSON field names
     if (CondObj->HasField(TEXT("keyOrName")))
@@ -173,6 +178,27 @@ bool FEAISJsonEditorParser::ParseEditorJson(const FString& Json, FAIEditorGraph&
     OutGraph.Name = Root->GetStringField(TEXT("name"));
     OutGraph.InitialState = Root->GetStringField(TEXT("initialState"));
 
+    int32 MaxTransitions = 1;
+    if (Root->TryGetNumberField(TEXT("maxTransitionsPerTick"), MaxTransitions) ||
+        Root->TryGetNumberField(TEXT("MaxTransitionsPerTick"), MaxTransitions))
+    {
+        OutGraph.MaxTransitionsPerTick = FMath::Max(1, MaxTransitions);
+    }
+
+    // Scoring queries (same format as the runtime parser)
+    const TArray<TSharedPtr<FJsonValue>>* QueriesArrayPtr = nullptr;
+    if (Root->TryGetArrayField(TEXT("queries"), QueriesArrayPtr))
+    {
+        for (const TSharedPtr<FJsonValue>& Val : *QueriesArrayPtr)
+        {
+            FEAISQueryDef Query;
+            if (UAIBehaviour::ParseQueryJson(Val->AsObject(), Query))
+            {
+                OutGraph.Queries.Add(MoveTemp(Query));
+            }
+        }
+    }
+
     const TArray<TSharedPtr<FJsonValue>>* StatesArrayPtr = nullptr;
     if (Root->TryGetArrayField(TEXT("states"), StatesArrayPtr))
     {
@@ -257,6 +283,8 @@ bool FEAISJsonEditorParser::ConvertEditorGraphToRuntime(const FAIEditorGraph& In
 {
     OutDef.Name = InGraph.Name;
     OutDef.InitialState = InGraph.InitialState;
+    OutDef.MaxTransitionsPerTick = FMath::Max(1, InGraph.MaxTransitionsPerTick);
+    OutDef.Queries = InGraph.Queries;
 
     for (const auto& EState : InGraph.States)
     {
@@ -280,10 +308,40 @@ bool FEAISJsonEditorParser::ConvertEditorGraphToRuntime(const FAIEditorGraph& In
     return true;
 }
 
+// Helper to build the canonical runtime JSON object (shared by runtime and editor serialization)
+static TSharedPtr<FJsonObject> MakeRuntimeJsonObject(const FAIBehaviorDef& InDef);
+
 FString FEAISJsonEditorParser::SerializeEditorGraph(const FAIEditorGraph& InGraph)
 {
-    // TODO: Implement full serialization
-    return TEXT("{}");
+    // Same layout as the runtime JSON (so ParseEditorJson reads it back), plus the editor metadata
+    FAIBehaviorDef Def;
+    Def.Name = InGraph.Name;
+    Def.InitialState = InGraph.InitialState;
+    Def.MaxTransitionsPerTick = FMath::Max(1, InGraph.MaxTransitionsPerTick);
+    Def.Queries = InGraph.Queries;
+    for (const auto& EState : InGraph.States)
+    {
+        FAIState S;
+        S.Id = EState.Id;
+        S.bTerminal = EState.bTerminal;
+        S.OnEnter = EState.OnEnter;
+        S.OnTick = EState.OnTick;
+        S.OnExit = EState.OnExit;
+        S.Transitions = EState.Transitions;
+        Def.States.Add(S);
+    }
+
+    TSharedPtr<FJsonObject> Root = MakeRuntimeJsonObject(Def);
+    if (InGraph.EditorMetadata.IsValid())
+    {
+        Root->SetObjectField(TEXT("editor"), InGraph.EditorMetadata);
+    }
+
+    FString OutJson;
+    TSharedRef<TJsonWriter<>> Writer = TJsonWriterFactory<>::Create(&OutJson);
+    FJsonSerializer::Serialize(Root.ToSharedRef(), Writer);
+
+    return OutJson;
 }
 
 // Helper to get condition type as string
@@ -295,6 +353,7 @@ static FString ConditionTypeToString(EAIConditionType Type)
         case EAIConditionType::Event: return TEXT("Event");
         case EAIConditionType::Timer: return TEXT("Timer");
         case EAIConditionType::Distance: return TEXT("Distance");
+        case EAIConditionType::Action: return TEXT("Action");
         default: return TEXT("Blackboard");
     }
 }
@@ -330,10 +389,25 @@ static FString ValueTypeToString(EBlackboardValueType Type)
 }
 
 FString FEAISJsonSerializer::SerializeRuntime(const FAIBehaviorDef& InDef)
+{
+    TSharedPtr<FJsonObject> Root = MakeRuntimeJsonObject(InDef);
+
+    FString OutJson;
+    TSharedRef<TJsonWriter<>> Writer = TJsonWriterFactory<>::Create(&OutJson);
+    FJsonSerializer::Serialize(Root.ToSharedRef(), Writer);
+
+    return OutJson;
+}
+
+static TSharedPtr<FJsonObject> MakeRuntimeJsonObject(const FAIBehaviorDef& InDef)
 {
     TSharedPtr<FJsonObject> Root = MakeShared<FJsonObject>();
     Root->SetStringField(TEXT("name"), InDef.Name);
     Root->SetStringField(TEXT("initialState"), InDef.InitialState);
+    if (InDef.MaxTransitionsPerTick > 1)
+    {
+        Root->SetNumberField(TEXT("maxTransitionsPerTick"), InDef.MaxTransitionsPerTick);
+    }
     
     // Serialize blackboard
     TArray<TSharedPtr<FJsonValue>> BlackboardArr;
@@ -377,6 +451,19 @@ FString FEAISJsonSerializer::SerializeRuntime(const FAIBehaviorDef& InDef)
                 {
                     ParamsObj->SetNumberField(TEXT("power"), Entry.Params.Power);
                 }
+                const FAIActionParams Defaults;
+                if (Entry.Params.AcceptanceRadius != Defaults.AcceptanceRadius)
+                {
+                    ParamsObj->SetNumberField(TEXT("acceptanceRadius"), Entry.Params.AcceptanceRadius);
+                }
+                if (Entry.Params.RetargetDistance != Defaults.RetargetDistance)
+                {
+                    ParamsObj->SetNumberField(TEXT("retargetDistance"), Entry.Params.RetargetDistance);
+                }
+                if (Entry.Params.RetargetInterval != Defaults.RetargetInterval)
+                {
+                    ParamsObj->SetNumberField(TEXT("retargetInterval"), Entry.Params.RetargetInterval);
+                }
                 FString ParamsJson;
                 TSharedRef<TJsonWriter<>> ParamsWriter = TJsonWriterFactory<>::Create(&ParamsJson);
                 FJsonSerializer::Serialize(ParamsObj.ToSharedRef(), ParamsWriter);
@@ -451,10 +538,17 @@ FString FEAISJsonSerializer::SerializeRuntime(const FAIBehaviorDef& InDef)
         StatesArr.Add(MakeShared<FJsonValueObject>(StateObj));
     }
     Root->SetArrayField(TEXT("states"), StatesArr);
+
+    // Serialize scoring queries
+    if (InDef.Queries.Num() > 0)
+    {
+        TArray<TSharedPtr<FJsonValue>> QueriesArr;
+        for (const FEAISQueryDef& Query : InDef.Queries)
+        {
+            QueriesArr.Add(MakeShared<FJsonValueObject>(UAIBehaviour::QueryToJson(Query)));
+        }
+        Root->SetArrayField(TEXT("queries"), QueriesArr);
+    }
     
-    FString OutJson;
-    TSharedRef<TJsonWriter<>> Writer = TJsonWriterFactory<>::Create(&OutJson);
-    FJsonSerializer::Serialize(Root.ToSharedRef(), Writer);
-    
-    return OutJson;
+    return Root;
 }
@@ -274,6 +274,7 @@ bool SEAIS_GraphEditor::ValidateGraph(TArray<FString> &OutErrors)
 void SEAIS_GraphEditor::CreateNewGraph(const FString &Name)
 {
     ClearGraph();
+    GraphName = Name;
 
     // Create default initial state
     const UEAIS_GraphSchema *Schema = UEAIS_GraphSchema::Get();
@@ -311,6 +312,9 @@ void SEAIS_GraphEditor::ClearGraph()
         EdGraph->NotifyGraphChanged();
     }
     CurrentFilePath.Empty();
+    GraphName.Empty();
+    GraphMaxTransitionsPerTick = 1;
+    GraphQueries.Empty();
 }
 
 void SEAIS_GraphEditor::OnGraphChanged(const FEdGraphEditAction &Action)
@@ -365,6 +369,9 @@ bool SEAIS_GraphEditor::CanDeleteNodes() const
 FAIEditorGraph SEAIS_GraphEditor::ExportToEditorGraph() const
 {
     FAIEditorGraph Result;
+    Result.Name = GraphName;
+    Result.MaxTransitionsPerTick = GraphMaxTransitionsPerTick;
+    Result.Queries = GraphQueries;
 
     if (!EdGraph)
         return Result;
@@ -400,6 +407,9 @@ FAIEditorGraph SEAIS_GraphEditor::ExportToEditorGraph() const
 void SEAIS_GraphEditor::ImportFromEditorGraph(const FAIEditorGraph &InGraph)
 {
     ClearGraph();
+    GraphName = InGraph.Name;
+    GraphMaxTransitionsPerTick = InGraph.MaxTransitionsPerTick;
+    GraphQueries = InGraph.Queries;
 
     if (!EdGraph)
         return;
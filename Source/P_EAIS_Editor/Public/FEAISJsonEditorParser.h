@@ -24,7 +24,11 @@ struct FAIEditorGraph
 
     FString Name;
     FString InitialState;
+    int32 MaxTransitionsPerTick = 1;
     TArray<FEditorState> States;
+
+    // Scoring queries (not shown as nodes, carried through load/save)
+    TArray<FEAISQueryDef> Queries;
     
     // Editor-only metadata (positions, colors, etc.)
     TSharedPtr<class FJsonObject> EditorMetadata;
@@ -7,6 +7,7 @@
 #include "Widgets/SCompoundWidget.h"
 #include "Widgets/Input/STextComboBox.h"
 #include "GraphEditor.h"
+#include "EAIS_Types.h"
 
 class UEdGraph;
 class UEAIS_GraphNode;
@@ -57,6 +58,11 @@ protected:
     
     /** Current file path */
     FString CurrentFilePath;
+
+    /** Graph-level data that has no nodes, kept from the loaded file so saving does not drop it */
+    FString GraphName;
+    int32 GraphMaxTransitionsPerTick = 1;
+    TArray<FEAISQueryDef> GraphQueries;
     
     /** Graph editor commands */
     TSharedPtr<FUICommandList> GraphEditorCommands;